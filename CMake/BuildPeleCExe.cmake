@@ -71,6 +71,8 @@ function(build_pelec_exe pelec_exe_name pelec_lib_name)
      PRIVATE
        ${SRC_DIR}/Advance.cpp
        ${SRC_DIR}/BCfill.cpp
+       ${SRC_DIR}/BndryPlaneCache.H
+       ${SRC_DIR}/BndryPlaneCache.cpp
        ${SRC_DIR}/Bld.cpp
        ${SRC_DIR}/Constants.H
        ${SRC_DIR}/Derive.H
@@ -86,6 +88,7 @@ function(build_pelec_exe pelec_exe_name pelec_lib_name)
        ${SRC_DIR}/Filter.H
        ${SRC_DIR}/Filter.cpp
        ${SRC_DIR}/Forcing.cpp
+       ${SRC_DIR}/FusedTagging.H
        ${SRC_DIR}/GradUtil.H
        ${SRC_DIR}/GradUtil.cpp
        ${SRC_DIR}/Hydro.H
@@ -110,11 +113,15 @@ function(build_pelec_exe pelec_exe_name pelec_lib_name)
        ${SRC_DIR}/PeleCAmr.H
        ${SRC_DIR}/PeleCAmr.cpp
        ${SRC_DIR}/ProblemDerive.H
+       ${SRC_DIR}/QuantizedPlotFile.H
+       ${SRC_DIR}/QuantizedPlotFile.cpp
+       ${SRC_DIR}/React.H
        ${SRC_DIR}/React.cpp
        ${SRC_DIR}/Riemann.H
        ${SRC_DIR}/Setup.cpp
        ${SRC_DIR}/Sources.cpp
        ${SRC_DIR}/SparseData.H
+       ${SRC_DIR}/SpeciesBlock.H
        ${SRC_DIR}/SumIQ.cpp
        ${SRC_DIR}/SumUtils.cpp
        ${SRC_DIR}/Tagging.H
@@ -142,7 +149,8 @@ function(build_pelec_exe pelec_exe_name pelec_lib_name)
     endif()
   endif()
 
-  if(NOT "${pelec_exe_name}" STREQUAL "PeleC-UnitTests")
+  if(NOT "${pelec_exe_name}" STREQUAL "PeleC-UnitTests" AND
+     NOT "${pelec_exe_name}" MATCHES "^PeleC-MicroBench")
     target_sources(${pelec_exe_name}
        PRIVATE
          ${CMAKE_SOURCE_DIR}/Source/main.cpp
@@ -0,0 +1,220 @@
+/** \file micro-bench-main.cpp
+ *  Timings of the per-cell PeleC kernels that loop over the species
+ *
+ *  Each kernel is run bench.nrep times over a box of bench.ncell cells per
+ *  direction holding a uniform mixture of all the species of the mechanism,
+ *  and the average time per cell (faces per second for the MOL fluxes) is
+ *  printed. One executable is built per mechanism. Usage:
+ *
+ *      PeleC-MicroBench-drm19 bench.ncell=64 bench.nrep=10
+ */
+
+#include <functional>
+#include <string>
+
+#include <AMReX.H>
+#include <AMReX_EBCellFlag.H>
+#include <AMReX_FArrayBox.H>
+#include <AMReX_IArrayBox.H>
+#include <AMReX_ParallelDescriptor.H>
+#include <AMReX_ParmParse.H>
+#include <AMReX_Print.H>
+
+#include "Diffterm.H"
+#include "IndexDefines.H"
+#include "MOL.H"
+#include "PelePhysics.H"
+#include "Utilities.H"
+
+// Necessary as it's used in other source files
+std::string inputs_name;
+
+namespace {
+// Average time of one call of kernel, in seconds
+amrex::Real
+average_time(const int nrep, const std::function<void()>& kernel)
+{
+  // Warm up
+  kernel();
+  amrex::Gpu::streamSynchronize();
+
+  const amrex::Real strt = amrex::ParallelDescriptor::second();
+  for (int rep = 0; rep < nrep; rep++) {
+    kernel();
+  }
+  amrex::Gpu::streamSynchronize();
+  const amrex::Real elapsed = amrex::ParallelDescriptor::second() - strt;
+  return elapsed / static_cast<amrex::Real>(nrep);
+}
+
+void
+time_kernel(
+  const std::string& name,
+  const amrex::Box& bx,
+  const int nrep,
+  const std::function<void()>& kernel)
+{
+  const amrex::Real t = average_time(nrep, kernel);
+  amrex::Print() << "  " << name << ": "
+                 << 1.0e9 * t / static_cast<amrex::Real>(bx.numPts())
+                 << " ns/cell" << std::endl;
+}
+
+void
+time_faces(
+  const std::string& name,
+  const amrex::Long nfaces,
+  const int nrep,
+  const std::function<void()>& kernel)
+{
+  const amrex::Real t = average_time(nrep, kernel);
+  amrex::Print() << "  " << name << ": "
+                 << static_cast<amrex::Real>(nfaces) / t << " faces/s"
+                 << std::endl;
+}
+
+void
+run_benchmarks()
+{
+  amrex::ParmParse pp("bench");
+  int ncell = 32;
+  int nrep = 10;
+  pp.query("ncell", ncell);
+  pp.query("nrep", nrep);
+
+  const amrex::Box bx(
+    amrex::IntVect(AMREX_D_DECL(0, 0, 0)),
+    amrex::IntVect(AMREX_D_DECL(ncell - 1, ncell - 1, ncell - 1)));
+  const amrex::Box gbx = amrex::grow(bx, 1);
+
+  amrex::Print() << "PeleC micro-benchmarks: " << NUM_SPECIES
+                 << " species, box " << bx << ", " << nrep << " repetitions"
+                 << std::endl;
+
+  // Uniform mixture at rest with small fluctuations of the temperature
+  amrex::FArrayBox ufab(gbx, NVAR, amrex::The_Arena());
+  amrex::FArrayBox qfab(gbx, QVAR, amrex::The_Arena());
+  amrex::FArrayBox qauxfab(gbx, NQAUX, amrex::The_Arena());
+  amrex::FArrayBox flxfab(gbx, NVAR, amrex::The_Arena());
+  amrex::IArrayBox maskfab(gbx, 1, amrex::The_Arena());
+  auto const& u = ufab.array();
+  auto const& q = qfab.array();
+  auto const& qaux = qauxfab.array();
+  auto const& flx = flxfab.array();
+  maskfab.setVal<amrex::RunOn::Device>(1);
+  qfab.setVal<amrex::RunOn::Device>(0.0);
+  flxfab.setVal<amrex::RunOn::Device>(0.0);
+  amrex::ParallelFor(gbx, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
+    auto eos = pele::physics::PhysicsType::eos();
+    amrex::Real massfrac[NUM_SPECIES];
+    for (int n = 0; n < NUM_SPECIES; n++) {
+      massfrac[n] = 1.0 / NUM_SPECIES;
+    }
+    const amrex::Real rho = 1.0e-3;
+    const amrex::Real T = 1000.0 + 10.0 * ((i + j + k) % 7);
+    amrex::Real e = 0.0;
+    eos.RTY2E(rho, T, massfrac, e);
+    for (int n = 0; n < NVAR; n++) {
+      u(i, j, k, n) = 0.0;
+    }
+    u(i, j, k, URHO) = rho;
+    u(i, j, k, UEINT) = rho * e;
+    u(i, j, k, UEDEN) = rho * e;
+    u(i, j, k, UTEMP) = T;
+    for (int n = 0; n < NUM_SPECIES; n++) {
+      u(i, j, k, UFS + n) = rho * massfrac[n];
+    }
+  });
+  amrex::Gpu::streamSynchronize();
+
+  time_kernel("pc_ctoprim", gbx, nrep, [=]() {
+    amrex::ParallelFor(
+      gbx, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
+        pc_ctoprim(i, j, k, u, q, qaux);
+      });
+  });
+
+  time_kernel("pc_cmpTemp", bx, nrep, [=]() {
+    amrex::ParallelFor(bx, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
+      pc_cmpTemp(i, j, k, u);
+    });
+  });
+
+  auto const& mask = maskfab.const_array();
+  time_kernel("clean_massfrac", bx, nrep, [=]() {
+    clean_massfrac(bx, 1.0e-8, mask, u);
+  });
+
+  amrex::GpuArray<amrex::Real, dComp_lambda + 1> coef = {0.0};
+  for (int n = 0; n < NUM_SPECIES; n++) {
+    coef[dComp_rhoD + n] = 1.0e-5;
+  }
+  const amrex::Real dxinv = static_cast<amrex::Real>(ncell);
+  auto const& qc = qfab.const_array();
+  time_kernel("SpeciesEnergyFlux", bx, nrep, [=]() {
+    amrex::ParallelFor(bx, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
+      const amrex::IntVect iv{AMREX_D_DECL(i, j, k)};
+      const amrex::IntVect ivm = iv - amrex::IntVect::TheDimensionVector(0);
+      FluxTypes::SpeciesEnergyFluxType()(iv, ivm, dxinv, coef, qc, flx);
+    });
+  });
+
+  time_kernel("SpeciesBlock gather/scatter", bx, nrep, [=]() {
+    amrex::ParallelFor(bx, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
+      SpeciesBlock spec;
+      spec.gather(u, i, j, k, UFS);
+      spec.scatter(q, i, j, k, QFS);
+    });
+  });
+
+  // MOL hydro fluxes over all the faces of the box, on regular cells with
+  // the primitive state of the uniform mixture
+  amrex::Print() << "MOL hydro fluxes (" << NUM_SPECIES << " species)"
+                 << std::endl;
+  amrex::ParallelFor(gbx, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
+    pc_ctoprim(i, j, k, u, q, qaux);
+  });
+  amrex::EBCellFlagFab flagfab(gbx, 1, amrex::The_Arena());
+  flagfab.setVal<amrex::RunOn::Device>(amrex::EBCellFlag::TheDefaultCell());
+  auto const& flags = flagfab.const_array();
+  amrex::FArrayBox mol_flx[AMREX_SPACEDIM];
+  amrex::FArrayBox mol_area[AMREX_SPACEDIM];
+  amrex::GpuArray<amrex::Array4<amrex::Real>, AMREX_SPACEDIM> flxarr;
+  amrex::Long nfaces = 0;
+  for (int dir = 0; dir < AMREX_SPACEDIM; dir++) {
+    const amrex::Box fbx = amrex::surroundingNodes(gbx, dir);
+    mol_flx[dir].resize(fbx, NVAR, amrex::The_Arena());
+    mol_area[dir].resize(fbx, 1, amrex::The_Arena());
+    mol_flx[dir].setVal<amrex::RunOn::Device>(0.0);
+    mol_area[dir].setVal<amrex::RunOn::Device>(1.0);
+    flxarr[dir] = mol_flx[dir].array();
+    nfaces += amrex::surroundingNodes(amrex::grow(bx, dir, -1), dir).numPts();
+  }
+  const amrex::GpuArray<const amrex::Array4<const amrex::Real>, AMREX_SPACEDIM>
+    areaarr = {AMREX_D_DECL(
+      mol_area[0].const_array(), mol_area[1].const_array(),
+      mol_area[2].const_array())};
+  const amrex::GpuArray<amrex::Real, AMREX_SPACEDIM> del = {
+    AMREX_D_DECL(1.0 / dxinv, 1.0 / dxinv, 1.0 / dxinv)};
+  auto const& qauxc = qauxfab.const_array();
+  for (const bool laxf : {false, true}) {
+    time_faces(
+      laxf ? "pc_compute_hyp_mol_flux (Lax-Friedrichs)"
+           : "pc_compute_hyp_mol_flux (Riemann)",
+      nfaces, nrep, [=]() {
+        pc_compute_hyp_mol_flux(
+          bx, qc, qauxc, flxarr, areaarr, del, 2, laxf, -1.0, flags, nullptr,
+          0, nullptr, 0);
+      });
+  }
+}
+} // namespace
+
+int
+main(int argc, char** argv)
+{
+  amrex::Initialize(argc, argv);
+  run_benchmarks();
+  amrex::Finalize();
+  return 0;
+}
@@ -1,121 +1,317 @@
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cstring>
+#include <string>
+#include <type_traits>
+
 #include "prob.H"
 
+PipeInflowStream::~PipeInflowStream()
+{
+  if (m_prefetch.valid()) {
+    m_prefetch.wait();
+  }
+  if (m_map != nullptr) {
+    munmap(const_cast<char*>(m_map), m_size);
+  }
+}
+
 void
-ReadPipeInflow(const std::string iname)
+PipeInflowStream::open(const std::string& iname, const int nslots)
 {
-  std::ifstream infile(iname, std::ios::in | std::ios::binary);
-  if (not infile.is_open()) {
+  const int fd = ::open(iname.c_str(), O_RDONLY);
+  if (fd < 0) {
     amrex::Abort("Unable to open input file " + iname);
   }
-
-  PeleC::h_prob_parm_device->inflowNtime = read_binary_int(infile);
-  PeleC::h_prob_parm_device->nr = read_binary_int(infile);
-  PeleC::h_prob_parm_device->nt = read_binary_int(infile);
-  PeleC::h_prob_parm_device->inflowFreq = read_binary_double(infile);
-  PeleC::h_prob_parm_device->timeFromInflow = read_binary_double(infile);
-
-  // Time grid
-  PeleC::prob_parm_host->h_timeInput.resize(
-    PeleC::h_prob_parm_device->inflowNtime);
-  PeleC::prob_parm_host->timeInput.resize(
-    PeleC::h_prob_parm_device->inflowNtime);
-  for (int i = 0; i < PeleC::prob_parm_host->h_timeInput.size(); i++) {
-    PeleC::prob_parm_host->h_timeInput[i] =
-      i * PeleC::h_prob_parm_device->inflowFreq;
+  struct stat st;
+  if (fstat(fd, &st) != 0) {
+    amrex::Abort("Unable to stat input file " + iname);
   }
-  PeleC::h_prob_parm_device->timeInflowMax = *std::max_element(
-    PeleC::prob_parm_host->h_timeInput.begin(),
-    PeleC::prob_parm_host->h_timeInput.end());
-
-  // Radial grid
-  PeleC::prob_parm_host->rInput.resize(PeleC::h_prob_parm_device->nr + 1, 0.0);
-  for (int i = 0; i < PeleC::prob_parm_host->rInput.size(); i++) {
-    PeleC::prob_parm_host->rInput[i] = read_binary_double(infile);
+  m_size = static_cast<size_t>(st.st_size);
+  if (m_size == 0) {
+    amrex::Abort("Inflow file " + iname + " is empty");
   }
-  PeleC::prob_parm_host->h_rM.resize(PeleC::h_prob_parm_device->nr, 0.0);
-  PeleC::prob_parm_host->rM.resize(PeleC::h_prob_parm_device->nr, 0.0);
-  for (int i = 0; i < PeleC::prob_parm_host->h_rM.size(); i++) {
-    PeleC::prob_parm_host->h_rM[i] =
-      PeleC::prob_parm_host->rInput[i + 1] * 0.5 +
-      PeleC::prob_parm_host->rInput[i] * 0.5;
+  void* map = mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, fd, 0);
+  ::close(fd);
+  if (map == MAP_FAILED) {
+    amrex::Abort("Unable to map input file " + iname);
+  }
+  m_map = static_cast<const char*>(map);
+
+  // Header, the file is not padded so values are copied out unaligned. Every
+  // read is checked against the size of the mapping first, so a short or
+  // corrupt file aborts instead of reading past its end.
+  size_t offset = 0;
+  const auto check_size = [&](const size_t nbytes) {
+    if ((nbytes > m_size) || (offset > m_size - nbytes)) {
+      amrex::Abort("Inflow file " + iname + " is truncated");
+    }
+  };
+  const auto read_header = [&](auto& val) {
+    check_size(sizeof(val));
+    std::memcpy(&val, m_map + offset, sizeof(val));
+    offset += sizeof(val);
+  };
+  double freq = 0.0;
+  double time_from_inflow = 0.0;
+  read_header(m_ntime);
+  read_header(m_nr);
+  read_header(m_nt);
+  read_header(freq);
+  read_header(time_from_inflow);
+  m_freq = freq;
+  m_time_from_inflow = time_from_inflow;
+  if ((m_ntime < 2) || (m_nr <= 0) || (m_nt <= 0)) {
+    amrex::Abort(
+      "Inflow file " + iname + " has an invalid header (" +
+      std::to_string(m_ntime) + " times, " + std::to_string(m_nr) + " x " +
+      std::to_string(m_nt) + " points)");
   }
 
-  // Azimuthal grid
-  PeleC::prob_parm_host->thetaInput.resize(
-    PeleC::h_prob_parm_device->nt + 1, 0.0);
-  for (int i = 0; i < PeleC::prob_parm_host->thetaInput.size(); i++) {
-    PeleC::prob_parm_host->thetaInput[i] = read_binary_double(infile);
+  const auto read_array = [&](const int n) {
+    const size_t nbytes = static_cast<size_t>(n) * sizeof(double);
+    check_size(nbytes);
+    amrex::Vector<double> vals(n);
+    std::memcpy(vals.data(), m_map + offset, nbytes);
+    offset += nbytes;
+    return vals;
+  };
+  const amrex::Vector<double> rInput = read_array(m_nr + 1);
+  const amrex::Vector<double> thetaInput = read_array(m_nt + 1);
+  m_vel_offset = offset;
+
+  const size_t nslab = static_cast<size_t>(m_nr) * m_nt;
+  check_size(3 * static_cast<size_t>(m_ntime) * nslab * sizeof(double));
+
+  // Time, radial and azimuthal grids
+  m_time_h.resize(m_ntime);
+  for (int i = 0; i < m_ntime; i++) {
+    m_time_h[i] = i * m_freq;
   }
-  PeleC::prob_parm_host->h_thetaM.resize(PeleC::h_prob_parm_device->nt, 0.0);
-  PeleC::prob_parm_host->thetaM.resize(PeleC::h_prob_parm_device->nt, 0.0);
-  for (int i = 0; i < PeleC::prob_parm_host->h_thetaM.size(); i++) {
-    PeleC::prob_parm_host->h_thetaM[i] =
-      0.5 * PeleC::prob_parm_host->thetaInput[i + 1] +
-      0.5 * PeleC::prob_parm_host->thetaInput[i];
+  amrex::Vector<amrex::Real> rM(m_nr);
+  for (int i = 0; i < m_nr; i++) {
+    rM[i] = rInput[i + 1] * 0.5 + rInput[i] * 0.5;
   }
-  PeleC::h_prob_parm_device->thetaMax = *std::max_element(
-    PeleC::prob_parm_host->h_thetaM.begin(),
-    PeleC::prob_parm_host->h_thetaM.end());
-
-  // Read in velocities
-  PeleC::prob_parm_host->h_Uz.resize(
-    PeleC::h_prob_parm_device->inflowNtime * PeleC::h_prob_parm_device->nr *
-      PeleC::h_prob_parm_device->nt,
-    0.0);
-  PeleC::prob_parm_host->Uz.resize(
-    PeleC::h_prob_parm_device->inflowNtime * PeleC::h_prob_parm_device->nr *
-      PeleC::h_prob_parm_device->nt,
-    0.0);
-  for (int k = 0; k < PeleC::h_prob_parm_device->inflowNtime; k++) {
-    for (int j = 0; j < PeleC::h_prob_parm_device->nr; j++) {
-      for (int i = 0; i < PeleC::h_prob_parm_device->nt; i++) {
-        PeleC::prob_parm_host->h_Uz
-          [(k * PeleC::h_prob_parm_device->nr + j) *
-             PeleC::h_prob_parm_device->nt +
-           i] = read_binary_double(infile);
-      }
+  amrex::Vector<amrex::Real> thetaM(m_nt);
+  for (int i = 0; i < m_nt; i++) {
+    thetaM[i] = 0.5 * thetaInput[i + 1] + 0.5 * thetaInput[i];
+  }
+  m_theta_max = *std::max_element(thetaM.begin(), thetaM.end());
+
+  m_time.resize(m_ntime);
+  m_rM.resize(m_nr);
+  m_thetaM.resize(m_nt);
+  amrex::Gpu::copy(
+    amrex::Gpu::hostToDevice, m_time_h.begin(), m_time_h.end(),
+    m_time.begin());
+  amrex::Gpu::copy(
+    amrex::Gpu::hostToDevice, rM.begin(), rM.end(), m_rM.begin());
+  amrex::Gpu::copy(
+    amrex::Gpu::hostToDevice, thetaM.begin(), thetaM.end(), m_thetaM.begin());
+
+  // Window of slabs, at least the two bracketing slabs and a prefetched one
+  const bool resident = (nslots <= 0) || (nslots >= m_ntime);
+  m_nslots = resident ? m_ntime : std::max(nslots, 3);
+  m_Uz.resize(m_nslots * nslab);
+  m_Ur.resize(m_nslots * nslab);
+  m_Ut.resize(m_nslots * nslab);
+  m_slot_h.assign(m_ntime, -1);
+  m_slot.resize(m_ntime);
+  m_slab.assign(m_nslots, -1);
+  m_last_use.assign(m_nslots, -1);
+  m_buf.resize(3 * nslab);
+  m_prefetch_buf.resize(3 * nslab);
+
+  if (resident) {
+    for (int k = 0; k < m_ntime; k++) {
+      read_slab(k, m_buf.data());
+      upload(k, k, m_buf.data());
     }
   }
+  amrex::Gpu::copy(
+    amrex::Gpu::hostToDevice, m_slot_h.begin(), m_slot_h.end(),
+    m_slot.begin());
 
-  PeleC::prob_parm_host->h_Ur.resize(
-    PeleC::h_prob_parm_device->inflowNtime * PeleC::h_prob_parm_device->nr *
-      PeleC::h_prob_parm_device->nt,
-    0.0);
-  PeleC::prob_parm_host->Ur.resize(
-    PeleC::h_prob_parm_device->inflowNtime * PeleC::h_prob_parm_device->nr *
-      PeleC::h_prob_parm_device->nt,
-    0.0);
-  for (int k = 0; k < PeleC::h_prob_parm_device->inflowNtime; k++) {
-    for (int j = 0; j < PeleC::h_prob_parm_device->nr; j++) {
-      for (int i = 0; i < PeleC::h_prob_parm_device->nt; i++) {
-        PeleC::prob_parm_host->h_Ur
-          [(k * PeleC::h_prob_parm_device->nr + j) *
-             PeleC::h_prob_parm_device->nt +
-           i] = read_binary_double(infile);
+  amrex::Print() << "Pipe inflow: " << m_ntime << " time slabs of " << m_nr
+                 << " x " << m_nt << " points, " << m_nslots
+                 << " resident on the device" << std::endl;
+}
+
+void
+PipeInflowStream::read_slab(const int k, amrex::Real* buf) const
+{
+  const size_t nslab = static_cast<size_t>(m_nr) * m_nt;
+  for (int n = 0; n < 3; n++) {
+    // Components are stored one after the other, each as ntime slabs
+    const char* src =
+      m_map + m_vel_offset + (n * m_ntime + k) * nslab * sizeof(double);
+    if constexpr (std::is_same<amrex::Real, double>::value) {
+      std::memcpy(buf + n * nslab, src, nslab * sizeof(double));
+    } else {
+      for (size_t i = 0; i < nslab; i++) {
+        double val = 0.0;
+        std::memcpy(&val, src + i * sizeof(double), sizeof(double));
+        buf[n * nslab + i] = static_cast<amrex::Real>(val);
       }
     }
   }
+}
+
+void
+PipeInflowStream::upload(const int k, const int slot, const amrex::Real* buf)
+{
+  const size_t nslab = static_cast<size_t>(m_nr) * m_nt;
+  if (m_slab[slot] >= 0) {
+    m_slot_h[m_slab[slot]] = -1;
+  }
+  m_slab[slot] = k;
+  m_slot_h[k] = slot;
+  m_last_use[slot] = m_nprepare;
+
+  amrex::Gpu::copyAsync(
+    amrex::Gpu::hostToDevice, buf, buf + nslab, m_Uz.begin() + slot * nslab);
+  amrex::Gpu::copyAsync(
+    amrex::Gpu::hostToDevice, buf + nslab, buf + 2 * nslab,
+    m_Ur.begin() + slot * nslab);
+  amrex::Gpu::copyAsync(
+    amrex::Gpu::hostToDevice, buf + 2 * nslab, buf + 3 * nslab,
+    m_Ut.begin() + slot * nslab);
+  // The host buffer is reused as soon as this returns
+  amrex::Gpu::streamSynchronize();
+}
 
-  PeleC::prob_parm_host->h_Ut.resize(
-    PeleC::h_prob_parm_device->inflowNtime * PeleC::h_prob_parm_device->nr *
-      PeleC::h_prob_parm_device->nt,
-    0.0);
-  PeleC::prob_parm_host->Ut.resize(
-    PeleC::h_prob_parm_device->inflowNtime * PeleC::h_prob_parm_device->nr *
-      PeleC::h_prob_parm_device->nt,
-    0.0);
-  for (int k = 0; k < PeleC::h_prob_parm_device->inflowNtime; k++) {
-    for (int j = 0; j < PeleC::h_prob_parm_device->nr; j++) {
-      for (int i = 0; i < PeleC::h_prob_parm_device->nt; i++) {
-        PeleC::prob_parm_host->h_Ut
-          [(k * PeleC::h_prob_parm_device->nr + j) *
-             PeleC::h_prob_parm_device->nt +
-           i] = read_binary_double(infile);
+int
+PipeInflowStream::find_slot(const int k0, const int k1) const
+{
+  // Empty slot, otherwise the least recently needed one not holding k0/k1
+  int slot = -1;
+  for (int s = 0; s < m_nslots; s++) {
+    if (m_slab[s] < 0) {
+      return s;
+    }
+    if (
+      (m_slab[s] != k0) && (m_slab[s] != k1) &&
+      ((slot < 0) || (m_last_use[s] < m_last_use[slot]))) {
+      slot = s;
+    }
+  }
+  AMREX_ALWAYS_ASSERT(slot >= 0);
+  return slot;
+}
+
+void
+PipeInflowStream::start_prefetch(const int k)
+{
+  m_prefetch_slab = k;
+  m_prefetch = std::async(
+    std::launch::async, [this, k]() { read_slab(k, m_prefetch_buf.data()); });
+}
+
+void
+PipeInflowStream::prepare(const amrex::Real time)
+{
+  if (m_nslots == m_ntime) {
+    return;
+  }
+  m_nprepare++;
+
+  // Same slabs as InterpolateVelInflow
+  const amrex::Real timeInflow = std::fmod(time, time_max());
+  int k0 = 0;
+  locate(m_time_h.data(), m_ntime, timeInflow, k0);
+  k0 = std::min(k0, m_ntime - 2);
+  const int k1 = k0 + 1;
+
+  bool changed = false;
+  for (const int k : {k0, k1}) {
+    if (m_slot_h[k] >= 0) {
+      m_last_use[m_slot_h[k]] = m_nprepare;
+      continue;
+    }
+    changed = true;
+
+    // Finish the prefetch first, it is usually the missing slab
+    if (m_prefetch.valid()) {
+      m_prefetch.get();
+      const int slab = m_prefetch_slab;
+      m_prefetch_slab = -1;
+      upload(slab, find_slot(k0, k1), m_prefetch_buf.data());
+      if (slab == k) {
+        continue;
       }
     }
+    read_slab(k, m_buf.data());
+    upload(k, find_slot(k0, k1), m_buf.data());
+  }
+  if (changed) {
+    amrex::Gpu::copy(
+      amrex::Gpu::hostToDevice, m_slot_h.begin(), m_slot_h.end(),
+      m_slot.begin());
+  }
+
+  // Prefetch the slab needed next, wrapping around to the first pair
+  if (!m_prefetch.valid()) {
+    const int knext =
+      (k1 + 1 < m_ntime) ? k1 + 1 : ((m_slot_h[0] < 0) ? 0 : 1);
+    if (m_slot_h[knext] < 0) {
+      start_prefetch(knext);
+    }
   }
+}
+
+void
+ReadPipeInflow(const std::string iname, const int nslots)
+{
+  auto& inflow = PeleC::prob_parm_host->pipe_inflow;
+  inflow.open(iname, nslots);
+
+  PeleC::h_prob_parm_device->inflowNtime = inflow.ntime();
+  PeleC::h_prob_parm_device->nr = inflow.nr();
+  PeleC::h_prob_parm_device->nt = inflow.nt();
+  PeleC::h_prob_parm_device->inflowFreq = inflow.freq();
+  PeleC::h_prob_parm_device->timeFromInflow = inflow.time_from_inflow();
+  PeleC::h_prob_parm_device->timeInflowMax = inflow.time_max();
+  PeleC::h_prob_parm_device->thetaMax = inflow.theta_max();
+  PeleC::h_prob_parm_device->d_timeInput = inflow.d_time();
+  PeleC::h_prob_parm_device->d_rM = inflow.d_rM();
+  PeleC::h_prob_parm_device->d_thetaM = inflow.d_thetaM();
+  PeleC::h_prob_parm_device->d_Uz = inflow.d_Uz();
+  PeleC::h_prob_parm_device->d_Ur = inflow.d_Ur();
+  PeleC::h_prob_parm_device->d_Ut = inflow.d_Ut();
+  PeleC::h_prob_parm_device->d_slab_slot = inflow.d_slot();
+}
 
-  infile.close();
+void
+pc_pipe_inflow_plane(
+  const amrex::Box& plane,
+  amrex::FArrayBox& fab,
+  const amrex::Geometry& geom,
+  const amrex::Real time,
+  const amrex::Orientation /*face*/)
+{
+  if (time > PeleC::h_prob_parm_device->inj_time) {
+    return;
+  }
+  PeleC::prob_parm_host->pipe_inflow.prepare(time);
+
+  const ProbParmDevice* lprobparm = PeleC::d_prob_parm_device;
+  const auto geomdata = geom.data();
+  const auto& vel = fab.array();
+  amrex::ParallelFor(plane, [=] AMREX_GPU_DEVICE(int i, int j, int k) {
+    const amrex::Real* prob_lo = geomdata.ProbLo();
+    const amrex::Real* dx = geomdata.CellSize();
+    const amrex::Real x[AMREX_SPACEDIM] = {AMREX_D_DECL(
+      prob_lo[0] + (i + 0.5) * dx[0], prob_lo[1] + (j + 0.5) * dx[1],
+      prob_lo[2] + (k + 0.5) * dx[2])};
+    amrex::Real v[3] = {0.0};
+    pipe_inflow_velocity(x, time, *lprobparm, v);
+    for (int n = 0; n < 3; n++) {
+      vel(i, j, k, n) = v[n];
+    }
+  });
 }
 
 void
@@ -235,6 +431,8 @@ amrex_probinit(
   amrex::ParmParse ppin("inflow");
   ppin.query("inflowProfileFile", PeleC::prob_parm_host->inflowProfileFile);
   ppin.query("turb_inflow_type", PeleC::h_prob_parm_device->turb_inflow_type);
+  int inflow_window = 0;
+  ppin.query("window_slabs", inflow_window);
 
   if (not PeleC::h_prob_parm_device->hitIC) {
     amrex::Print() << "Skipping HIT IC input file reading and assuming restart."
@@ -296,29 +494,10 @@ amrex_probinit(
 
   // Read inflow
   if (PeleC::h_prob_parm_device->turb_inflow_type == 1) {
-    ReadPipeInflow(PeleC::prob_parm_host->inflowProfileFile);
+    ReadPipeInflow(PeleC::prob_parm_host->inflowProfileFile, inflow_window);
+    PeleC::prob_inflow_planes.set_fill(pc_pipe_inflow_plane);
   }
 
-  amrex::Gpu::copy(
-    amrex::Gpu::hostToDevice, PeleC::prob_parm_host->h_timeInput.begin(),
-    PeleC::prob_parm_host->h_timeInput.end(),
-    PeleC::prob_parm_host->timeInput.begin());
-  amrex::Gpu::copy(
-    amrex::Gpu::hostToDevice, PeleC::prob_parm_host->h_rM.begin(),
-    PeleC::prob_parm_host->h_rM.end(), PeleC::prob_parm_host->rM.begin());
-  amrex::Gpu::copy(
-    amrex::Gpu::hostToDevice, PeleC::prob_parm_host->h_thetaM.begin(),
-    PeleC::prob_parm_host->h_thetaM.end(),
-    PeleC::prob_parm_host->thetaM.begin());
-  amrex::Gpu::copy(
-    amrex::Gpu::hostToDevice, PeleC::prob_parm_host->h_Uz.begin(),
-    PeleC::prob_parm_host->h_Uz.end(), PeleC::prob_parm_host->Uz.begin());
-  amrex::Gpu::copy(
-    amrex::Gpu::hostToDevice, PeleC::prob_parm_host->h_Ur.begin(),
-    PeleC::prob_parm_host->h_Ur.end(), PeleC::prob_parm_host->Ur.begin());
-  amrex::Gpu::copy(
-    amrex::Gpu::hostToDevice, PeleC::prob_parm_host->h_Ut.begin(),
-    PeleC::prob_parm_host->h_Ut.end(), PeleC::prob_parm_host->Ut.begin());
   amrex::Gpu::copy(
     amrex::Gpu::hostToDevice, PeleC::prob_parm_host->h_xinput.begin(),
     PeleC::prob_parm_host->h_xinput.end(),
@@ -344,13 +523,6 @@ amrex_probinit(
     PeleC::prob_parm_host->h_xdiff.end(), PeleC::prob_parm_host->xdiff.begin());
 
   // Get pointers to the data
-  PeleC::h_prob_parm_device->d_timeInput =
-    PeleC::prob_parm_host->timeInput.data();
-  PeleC::h_prob_parm_device->d_rM = PeleC::prob_parm_host->rM.data();
-  PeleC::h_prob_parm_device->d_thetaM = PeleC::prob_parm_host->thetaM.data();
-  PeleC::h_prob_parm_device->d_Uz = PeleC::prob_parm_host->Uz.data();
-  PeleC::h_prob_parm_device->d_Ur = PeleC::prob_parm_host->Ur.data();
-  PeleC::h_prob_parm_device->d_Ut = PeleC::prob_parm_host->Ut.data();
   PeleC::h_prob_parm_device->d_xinput = PeleC::prob_parm_host->xinput.data();
   PeleC::h_prob_parm_device->d_uinput = PeleC::prob_parm_host->uinput.data();
   PeleC::h_prob_parm_device->d_vinput = PeleC::prob_parm_host->vinput.data();
@@ -370,6 +542,11 @@ PeleC::problem_post_timestep()
 {
 }
 
+void
+PeleC::problem_pre_initdata()
+{
+}
+
 void
 PeleC::problem_post_init()
 {
@@ -270,6 +270,11 @@ PeleC::problem_post_timestep()
 #endif
 }
 
+void
+PeleC::problem_pre_initdata()
+{
+}
+
 void
 PeleC::problem_post_init()
 {
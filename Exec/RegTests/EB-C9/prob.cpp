@@ -102,6 +102,11 @@ PeleC::problem_post_timestep()
   }
 }
 
+void
+PeleC::problem_pre_initdata()
+{
+}
+
 void
 PeleC::problem_post_init()
 {
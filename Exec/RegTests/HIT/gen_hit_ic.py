@@ -51,6 +51,12 @@ parser.add_argument(
 parser.add_argument(
     "-p", "--plot", help="Save a plot of the x-velocity", action="store_true"
 )
+parser.add_argument(
+    "-b",
+    "--binary",
+    help="Save the data as raw doubles (prob.binfmt = true)",
+    action="store_true",
+)
 args = parser.parse_args()
 
 # ===============================================================================
@@ -319,7 +325,10 @@ wr = spi.interpn((xc, xc, xc), w, (Xr, Yr, Zr), method="linear")
 # Save the data in Fortran ordering
 fname = "hit_ic_{0:d}_{1:d}.dat".format(int(args.k0), args.N)
 data = np.vstack((Xr, Yr, Zr, ur, vr, wr)).T
-np.savetxt(fname, data, fmt="%.18e", delimiter=",", header="x, y, z, u, v, w")
+if args.binary:
+    data.astype(np.float64).tofile(fname)
+else:
+    np.savetxt(fname, data, fmt="%.18e", delimiter=",", header="x, y, z, u, v, w")
 
 
 # ========================================================================
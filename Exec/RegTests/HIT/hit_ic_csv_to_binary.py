@@ -0,0 +1,76 @@
+#!/usr/bin/env python
+#
+# Convert a csv HIT initial condition (header line, then one
+# "x, y, z, u, v, w" row per point in Fortran order) to the binary format
+# read with prob.binfmt = true (HIT) or ic.binfmt = true (ChallengeProblem):
+# the same rows written as raw native doubles.
+#
+# The rows are streamed and written in chunks, so inputs larger than the
+# memory can be converted.
+#
+
+# ========================================================================
+#
+# Imports
+#
+# ========================================================================
+import argparse
+import array
+import sys
+
+# ========================================================================
+#
+# Parse arguments
+#
+# ========================================================================
+parser = argparse.ArgumentParser(
+    description="Convert a csv HIT initial condition to the binary format"
+)
+parser.add_argument("input", help="csv input file")
+parser.add_argument("output", help="binary output file")
+parser.add_argument(
+    "-N",
+    help="Input resolution, to check the number of rows (prob.inres)",
+    type=int,
+    default=0,
+)
+parser.add_argument(
+    "-c", "--chunk", help="Number of rows per chunk", type=int, default=1 << 16
+)
+args = parser.parse_args()
+
+# ========================================================================
+#
+# Main
+#
+# ========================================================================
+ncol = 6
+nrows = 0
+with open(args.input, "r") as fin, open(args.output, "wb") as fout:
+    fin.readline()  # header
+    buf = array.array("d")
+    for line in fin:
+        vals = line.replace(",", " ").split()
+        if not vals:
+            continue
+        if len(vals) != ncol:
+            print(
+                "Expected {0:d} columns on row {1:d}, found {2:d}. Exiting".format(
+                    ncol, nrows + 1, len(vals)
+                )
+            )
+            sys.exit(1)
+        buf.extend(float(v) for v in vals)
+        nrows += 1
+        if nrows % args.chunk == 0:
+            buf.tofile(fout)
+            buf = array.array("d")
+    buf.tofile(fout)
+
+if args.N > 0 and nrows != args.N ** 3:
+    print(
+        "Number of rows (= {0:d}) does not match the input resolution "
+        "(= {1:d}). Exiting".format(nrows, args.N)
+    )
+    sys.exit(1)
+print("Wrote {0:d} rows to {1:s}".format(nrows, args.output))
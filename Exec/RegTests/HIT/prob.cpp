@@ -5,6 +5,53 @@ pc_prob_close()
 {
 }
 
+namespace {
+// Scale the velocities (the last three of ncol columns) read from the input
+// file and copy them to the device
+void
+set_input_velocities(const amrex::Vector<amrex::Real>& data, const int ncol)
+{
+  // Kernels using the previous input data may still be running
+  amrex::Gpu::streamSynchronize();
+
+  const long npts = data.size() / ncol;
+  PeleC::prob_parm_host->h_uinput.resize(npts);
+  PeleC::prob_parm_host->h_vinput.resize(npts);
+  PeleC::prob_parm_host->h_winput.resize(npts);
+  for (long i = 0; i < npts; i++) {
+    PeleC::prob_parm_host->h_uinput[i] = data[ncol - 3 + i * ncol] *
+                                         PeleC::h_prob_parm_device->urms0 /
+                                         PeleC::h_prob_parm_device->uin_norm;
+    PeleC::prob_parm_host->h_vinput[i] = data[ncol - 2 + i * ncol] *
+                                         PeleC::h_prob_parm_device->urms0 /
+                                         PeleC::h_prob_parm_device->uin_norm;
+    PeleC::prob_parm_host->h_winput[i] = data[ncol - 1 + i * ncol] *
+                                         PeleC::h_prob_parm_device->urms0 /
+                                         PeleC::h_prob_parm_device->uin_norm;
+  }
+
+  PeleC::prob_parm_host->uinput.resize(npts);
+  PeleC::prob_parm_host->vinput.resize(npts);
+  PeleC::prob_parm_host->winput.resize(npts);
+  amrex::Gpu::copy(
+    amrex::Gpu::hostToDevice, PeleC::prob_parm_host->h_uinput.begin(),
+    PeleC::prob_parm_host->h_uinput.end(),
+    PeleC::prob_parm_host->uinput.begin());
+  amrex::Gpu::copy(
+    amrex::Gpu::hostToDevice, PeleC::prob_parm_host->h_vinput.begin(),
+    PeleC::prob_parm_host->h_vinput.end(),
+    PeleC::prob_parm_host->vinput.begin());
+  amrex::Gpu::copy(
+    amrex::Gpu::hostToDevice, PeleC::prob_parm_host->h_winput.begin(),
+    PeleC::prob_parm_host->h_winput.end(),
+    PeleC::prob_parm_host->winput.begin());
+
+  PeleC::h_prob_parm_device->d_uinput = PeleC::prob_parm_host->uinput.data();
+  PeleC::h_prob_parm_device->d_vinput = PeleC::prob_parm_host->vinput.data();
+  PeleC::h_prob_parm_device->d_winput = PeleC::prob_parm_host->winput.data();
+}
+} // namespace
+
 extern "C" {
 void
 amrex_probinit(
@@ -93,13 +140,13 @@ amrex_probinit(
     << PeleC::h_prob_parm_device->forcing_w0 << std::endl;
   ofs.close();
 
-  // Load velocity fields from file. Assume data set ordered in Fortran
-  // format and reshape the data accordingly. One thing to keep in mind
-  // is that this contains the entire input data. We will interpolate
-  // this data later to just match our box. Another assumption is that
-  // the input data is a periodic cube. If the input cube is smaller
-  // than our domain size, the cube will be repeated throughout the
-  // domain (hence the mod operations in the interpolation).
+  // Load the input coordinates from file. Assume data set ordered in
+  // Fortran format. Another assumption is that the input data is a
+  // periodic cube. If the input cube is smaller than our domain size, the
+  // cube will be repeated throughout the domain (hence the mod operations
+  // in the interpolation). For binary input, each rank only reads the
+  // velocities it needs for its grids, level by level, in
+  // problem_pre_initdata. The csv input is read in full here.
   if (PeleC::h_prob_parm_device->restart) {
     amrex::Print() << "Skipping input file reading and assuming restart."
                    << std::endl;
@@ -110,37 +157,35 @@ amrex_probinit(
     const size_t nx = PeleC::h_prob_parm_device->inres;
     const size_t ny = PeleC::h_prob_parm_device->inres;
     const size_t nz = PeleC::h_prob_parm_device->inres;
-    amrex::Vector<amrex::Real> data(
-      nx * ny * nz * 6); /* this needs to be double */
+    PeleC::prob_parm_host->h_xarray.resize(nx);
     if (PeleC::h_prob_parm_device->binfmt) {
-      read_binary(PeleC::prob_parm_host->iname, nx, ny, nz, 6, data);
+      // The x coordinates are the first column of the first nx rows
+      read_binary_window(
+        PeleC::prob_parm_host->iname, nx, ny, nz, 6, amrex::IntVect(0),
+        amrex::IntVect(AMREX_D_DECL(static_cast<int>(nx), 1, 1)), 0, 1,
+        PeleC::prob_parm_host->h_xarray);
     } else {
+      if (amrex::ParallelDescriptor::NProcs() > 1) {
+        amrex::Print() << "Warning: the csv input is read in full on every "
+                          "rank, convert it with hit_ic_csv_to_binary.py and "
+                          "set prob.binfmt = true for large inputs"
+                       << std::endl;
+      }
+      amrex::Vector<amrex::Real> data(
+        nx * ny * nz * 6); /* this needs to be double */
       read_csv(PeleC::prob_parm_host->iname, nx, ny, nz, data);
+      for (long i = 0; i < PeleC::prob_parm_host->h_xarray.size(); i++) {
+        PeleC::prob_parm_host->h_xarray[i] = data[0 + i * 6];
+      }
+      set_input_velocities(data, 6);
+      for (int dir = 0; dir < 3; dir++) {
+        PeleC::h_prob_parm_device->win_lo[dir] = 0;
+        PeleC::h_prob_parm_device->win_len[dir] =
+          PeleC::h_prob_parm_device->inres;
+      }
     }
 
-    // Extract position and velocities
-    PeleC::prob_parm_host->h_xinput.resize(nx * ny * nz);
-    PeleC::prob_parm_host->h_uinput.resize(nx * ny * nz);
-    PeleC::prob_parm_host->h_vinput.resize(nx * ny * nz);
-    PeleC::prob_parm_host->h_winput.resize(nx * ny * nz);
-    for (long i = 0; i < PeleC::prob_parm_host->h_xinput.size(); i++) {
-      PeleC::prob_parm_host->h_xinput[i] = data[0 + i * 6];
-      PeleC::prob_parm_host->h_uinput[i] = data[3 + i * 6] *
-                                           PeleC::h_prob_parm_device->urms0 /
-                                           PeleC::h_prob_parm_device->uin_norm;
-      PeleC::prob_parm_host->h_vinput[i] = data[4 + i * 6] *
-                                           PeleC::h_prob_parm_device->urms0 /
-                                           PeleC::h_prob_parm_device->uin_norm;
-      PeleC::prob_parm_host->h_winput[i] = data[5 + i * 6] *
-                                           PeleC::h_prob_parm_device->urms0 /
-                                           PeleC::h_prob_parm_device->uin_norm;
-    }
-
-    // Get the xarray table and the differences.
-    PeleC::prob_parm_host->h_xarray.resize(nx);
-    for (long i = 0; i < PeleC::prob_parm_host->h_xarray.size(); i++) {
-      PeleC::prob_parm_host->h_xarray[i] = PeleC::prob_parm_host->h_xinput[i];
-    }
+    // Get the differences of the xarray table.
     PeleC::prob_parm_host->h_xdiff.resize(nx);
     std::adjacent_difference(
       PeleC::prob_parm_host->h_xarray.begin(),
@@ -156,33 +201,9 @@ amrex_probinit(
     }
 
     // Get pointer to the data
-    PeleC::prob_parm_host->xinput.resize(
-      PeleC::prob_parm_host->h_xinput.size());
-    PeleC::prob_parm_host->uinput.resize(
-      PeleC::prob_parm_host->h_uinput.size());
-    PeleC::prob_parm_host->vinput.resize(
-      PeleC::prob_parm_host->h_vinput.size());
-    PeleC::prob_parm_host->winput.resize(
-      PeleC::prob_parm_host->h_winput.size());
     PeleC::prob_parm_host->xarray.resize(
       PeleC::prob_parm_host->h_xarray.size());
     PeleC::prob_parm_host->xdiff.resize(PeleC::prob_parm_host->h_xdiff.size());
-    amrex::Gpu::copy(
-      amrex::Gpu::hostToDevice, PeleC::prob_parm_host->h_xinput.begin(),
-      PeleC::prob_parm_host->h_xinput.end(),
-      PeleC::prob_parm_host->xinput.begin());
-    amrex::Gpu::copy(
-      amrex::Gpu::hostToDevice, PeleC::prob_parm_host->h_uinput.begin(),
-      PeleC::prob_parm_host->h_uinput.end(),
-      PeleC::prob_parm_host->uinput.begin());
-    amrex::Gpu::copy(
-      amrex::Gpu::hostToDevice, PeleC::prob_parm_host->h_vinput.begin(),
-      PeleC::prob_parm_host->h_vinput.end(),
-      PeleC::prob_parm_host->vinput.begin());
-    amrex::Gpu::copy(
-      amrex::Gpu::hostToDevice, PeleC::prob_parm_host->h_winput.begin(),
-      PeleC::prob_parm_host->h_winput.end(),
-      PeleC::prob_parm_host->winput.begin());
     amrex::Gpu::copy(
       amrex::Gpu::hostToDevice, PeleC::prob_parm_host->h_xarray.begin(),
       PeleC::prob_parm_host->h_xarray.end(),
@@ -192,10 +213,6 @@ amrex_probinit(
       PeleC::prob_parm_host->h_xdiff.end(),
       PeleC::prob_parm_host->xdiff.begin());
 
-    PeleC::h_prob_parm_device->d_xinput = PeleC::prob_parm_host->xinput.data();
-    PeleC::h_prob_parm_device->d_uinput = PeleC::prob_parm_host->uinput.data();
-    PeleC::h_prob_parm_device->d_vinput = PeleC::prob_parm_host->vinput.data();
-    PeleC::h_prob_parm_device->d_winput = PeleC::prob_parm_host->winput.data();
     PeleC::h_prob_parm_device->d_xarray = PeleC::prob_parm_host->xarray.data();
     PeleC::h_prob_parm_device->d_xdiff = PeleC::prob_parm_host->xdiff.data();
 
@@ -213,6 +230,48 @@ PeleC::problem_post_timestep()
 {
 }
 
+void
+PeleC::problem_pre_initdata()
+{
+  // Read the input velocities needed by the grids this rank owns on this
+  // level. The csv input was read in full in amrex_probinit.
+  if (
+    PeleC::h_prob_parm_device->restart || !PeleC::h_prob_parm_device->binfmt) {
+    return;
+  }
+
+#ifndef AMREX_USE_FLOAT
+  const amrex::Real strt_time = amrex::ParallelDescriptor::second();
+  const int inres = PeleC::h_prob_parm_device->inres;
+  amrex::IntVect lo(0);
+  amrex::IntVect len(1);
+  input_window(
+    grids, dmap, geom, PeleC::prob_parm_host->h_xarray.data(), inres,
+    PeleC::h_prob_parm_device->Linput, lo, len);
+
+  // Read the u, v, w columns of the window
+  amrex::Vector<amrex::Real> data;
+  read_binary_window(
+    PeleC::prob_parm_host->iname, inres, inres, inres, 6, lo, len, 3, 3, data);
+  set_input_velocities(data, 3);
+  for (int dir = 0; dir < AMREX_SPACEDIM; dir++) {
+    PeleC::h_prob_parm_device->win_lo[dir] = lo[dir];
+    PeleC::h_prob_parm_device->win_len[dir] = len[dir];
+  }
+
+  if (verbose > 0) {
+    const int IOProc = amrex::ParallelDescriptor::IOProcessorNumber();
+    amrex::Real run_time = amrex::ParallelDescriptor::second() - strt_time;
+    amrex::Long nbytes = static_cast<amrex::Long>(len.product()) * 6 *
+                         static_cast<amrex::Long>(sizeof(amrex::Real));
+    amrex::ParallelDescriptor::ReduceRealMax(run_time, IOProc);
+    amrex::ParallelDescriptor::ReduceLongSum(nbytes, IOProc);
+    amrex::Print() << "HIT input read on level " << level << ": " << nbytes
+                   << " bytes, time = " << run_time << std::endl;
+  }
+#endif
+}
+
 void
 PeleC::problem_post_init()
 {
@@ -0,0 +1,41 @@
+#!/bin/bash
+#
+# Time the startup of the HIT case from the csv and from the binary form of
+# the same initial condition. Each run takes no step and writes no output, so
+# its wall time is dominated by reading and interpolating the input.
+#
+# Usage:
+#   ./time_ic_startup.sh <PeleC-HIT executable> <inputs> <csv IC> [launcher]
+# e.g.
+#   ./time_ic_startup.sh ./PeleC-HIT hit-1.inp hit_ic_4_32.dat mpiexec -n 4
+
+set -e
+
+if [ $# -lt 3 ]; then
+  sed -n '3,10p' "$0"
+  exit 1
+fi
+
+exe=$1
+inputs=$2
+csv=$3
+shift 3
+bin="${csv%.*}.bin"
+
+python3 "$(dirname "$0")/hit_ic_csv_to_binary.py" "${csv}" "${bin}"
+
+opts="max_step=0 pelec.v=1 amr.plot_files_output=0"
+opts="${opts} amr.checkpoint_files_output=0"
+for fmt in csv binary; do
+  if [ "${fmt}" = "csv" ]; then
+    ic="prob.iname=${csv} prob.binfmt=0"
+  else
+    ic="prob.iname=${bin} prob.binfmt=1"
+  fi
+  start=$(date +%s.%N)
+  "$@" "${exe}" "${inputs}" ${ic} ${opts} > "startup_${fmt}.log"
+  end=$(date +%s.%N)
+  awk -v f="${fmt}" -v s="${start}" -v e="${end}" \
+    'BEGIN { printf "%s startup: %.3f s\n", f, e - s }'
+  grep "HIT input read" "startup_${fmt}.log" || true
+done
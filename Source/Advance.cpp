@@ -95,9 +95,8 @@ PeleC::do_mol_advance(
   AMREX_ASSERT(Sborder.nGrow() >= nGrow_FP_border);
 #endif
 
-  FillPatcherFill(Sborder, 0, NVAR, nGrow_FP_border, time, State_Type, 0);
   amrex::Real flux_factor = 0;
-  getMOLSrcTerm(Sborder, molSrc, time, dt, flux_factor);
+  fill_sborder_mol_src(time, nGrow_FP_border, molSrc, dt, flux_factor);
 
   // Build other (non-diffusion) sources at t_old
   for (int n = 0; n < src_list.size(); ++n) {
@@ -116,24 +115,22 @@ PeleC::do_mol_advance(
   }
 
   // U^* = U^n + dt*S^n
-  amrex::MultiFab::LinComb(S_new, 1.0, Sborder, 0, dt, molSrc, 0, 0, NVAR, 0);
-
   // U^{n+1,*} = U^n + dt*S^n + dt*I_R
+  amrex::Vector<StateUpdateTerm> terms{
+    {&Sborder, 1.0, 0, 0, NVAR}, {&molSrc, dt, 0, 0, NVAR}};
   if (do_react) {
-    amrex::MultiFab::Saxpy(S_new, dt, I_R, 0, FirstSpec, NUM_SPECIES, 0);
-    amrex::MultiFab::Saxpy(S_new, dt, I_R, NUM_SPECIES, Eden, 1, 0);
+    terms.push_back({&I_R, dt, 0, FirstSpec, NUM_SPECIES});
+    terms.push_back({&I_R, dt, NUM_SPECIES, Eden, 1});
   }
-
-  computeTemp(S_new, 0);
+  fused_state_update(S_new, terms, 0, true);
 
   // Compute S^{n+1} = MOLRhs(U^{n+1,*})
   if (verbose != 0) {
     amrex::Print() << "... Computing MOL source term at t^{n+1} " << std::endl;
   }
 
-  FillPatcherFill(Sborder, 0, NVAR, nGrow_FP_border, time + dt, State_Type, 0);
   flux_factor = mol_iters > 1 ? 0 : 1;
-  getMOLSrcTerm(Sborder, molSrc, time, dt, flux_factor);
+  fill_sborder_mol_src(time + dt, nGrow_FP_border, molSrc, dt, flux_factor);
 
   // Build other (non-diffusion) sources at t_new
   for (int n = 0; n < src_list.size(); ++n) {
@@ -149,27 +146,33 @@ PeleC::do_mol_advance(
 
   // U^{n+1.**} = 0.5*(U^n + U^{n+1,*}) + 0.5*dt*S^{n+1} = U^n + 0.5*dt*S^n +
   // 0.5*dt*S^{n+1} + 0.5*dt*I_R
-  amrex::MultiFab::LinComb(S_new, 0.5, Sborder, 0, 0.5, S_old, 0, 0, NVAR, 0);
-  amrex::MultiFab::Saxpy(
-    S_new, 0.5 * dt, molSrc, 0, 0, NVAR,
-    0); //  NOTE: If I_R=0, we are done and U_new is the final new-time state
-
+  //  NOTE: If I_R=0, we are done and U_new is the final new-time state
+  terms = {
+    {&Sborder, 0.5, 0, 0, NVAR},
+    {&S_old, 0.5, 0, 0, NVAR},
+    {&molSrc, 0.5 * dt, 0, 0, NVAR}};
   if (do_react) {
-    amrex::MultiFab::Saxpy(S_new, 0.5 * dt, I_R, 0, FirstSpec, NUM_SPECIES, 0);
-    amrex::MultiFab::Saxpy(S_new, 0.5 * dt, I_R, NUM_SPECIES, Eden, 1, 0);
+    terms.push_back({&I_R, 0.5 * dt, 0, FirstSpec, NUM_SPECIES});
+    terms.push_back({&I_R, 0.5 * dt, NUM_SPECIES, Eden, 1});
+  }
+  fused_state_update(S_new, terms, 0, !do_react);
 
+  if (do_react) {
     // F_{AD} = (1/dt)(U^{n+1,**} - U^n) - I_R = 0.5*(S^{n}+S^{n+1}(which is a
     // guess!))
-    amrex::MultiFab::LinComb(
-      molSrc, 1.0 / dt, S_new, 0, -1.0 / dt, S_old, 0, 0, NVAR, 0);
-    amrex::MultiFab::Subtract(molSrc, I_R, 0, FirstSpec, NUM_SPECIES, 0);
-    amrex::MultiFab::Subtract(molSrc, I_R, NUM_SPECIES, Eden, 1, 0);
+    fused_state_update(
+      molSrc,
+      {{&S_new, 1.0 / dt, 0, 0, NVAR},
+       {&S_old, -1.0 / dt, 0, 0, NVAR},
+       {&I_R, -1.0, 0, FirstSpec, NUM_SPECIES},
+       {&I_R, -1.0, NUM_SPECIES, Eden, 1}},
+      0, false);
 
     // Compute I_R and U^{n+1} = U^n + dt*(F_{AD} + I_R)
     react_state(time, dt, false, &molSrc);
-  }
 
-  computeTemp(S_new, 0);
+    computeTemp(S_new, 0);
+  }
 
   if (do_react) {
     for (int mol_iter = 2; mol_iter <= mol_iters; ++mol_iter) {
@@ -178,10 +181,9 @@ PeleC::do_mol_advance(
                        << mol_iter << " of " << mol_iters << ")" << std::endl;
       }
 
-      FillPatcherFill(
-        Sborder, 0, NVAR, nGrow_FP_border, time + dt, State_Type, 0);
       flux_factor = mol_iter == mol_iters ? 1 : 0;
-      getMOLSrcTerm(Sborder, molSrc_new, time, dt, flux_factor);
+      fill_sborder_mol_src(
+        time + dt, nGrow_FP_border, molSrc_new, dt, flux_factor);
 
       // F_{AD} = (1/2)(molSrc_old + molSrc_new)
       amrex::MultiFab::LinComb(
@@ -218,14 +220,50 @@ PeleC::do_sdc_advance(
     get_new_data(Work_Estimate_Type).setVal(0.0);
   }
 
-  for (int sdc_iter = 0; sdc_iter < sdc_iters; ++sdc_iter) {
+  // With sdc_tol > 0, stop iterating once two consecutive iterates differ by
+  // less than sdc_tol. The refluxing and the particle updates are done on
+  // the final iteration only, so when iterate k has converged, iteration
+  // k + 1 is run as the final one.
+  const bool adaptive = (sdc_tol > 0.0) && (sdc_iters > 2);
+  amrex::MultiFab sdc_prev;
+  if (adaptive) {
+    sdc_prev.define(grids, dmap, NUM_SPECIES + 2, 0);
+  }
+  int sdc_ncycle = sdc_iters;
+  amrex::Real sdc_change = -1.0;
+
+  for (int sdc_iter = 0; sdc_iter < sdc_ncycle; ++sdc_iter) {
     if (sdc_iters > 1) {
-      amrex::Print() << "SDC iteration " << sdc_iter + 1 << " of " << sdc_iters
+      amrex::Print() << "SDC iteration " << sdc_iter + 1 << " of " << sdc_ncycle
                      << ".\n";
     }
 
     dt_new = do_sdc_iteration(
-      time, dt, amr_iteration, amr_ncycle, sdc_iter, sdc_iters);
+      time, dt, amr_iteration, amr_ncycle, sdc_iter, sdc_ncycle);
+
+    if (adaptive && (sdc_iter + 2 < sdc_ncycle)) {
+      if (sdc_iter > 0) {
+        sdc_change = sdc_iterate_change(sdc_prev);
+        if (sdc_change <= sdc_tol) {
+          sdc_ncycle = sdc_iter + 2;
+        }
+      }
+      if (sdc_iter + 2 < sdc_ncycle) {
+        const amrex::MultiFab& S_new = get_new_data(State_Type);
+        amrex::MultiFab::Copy(sdc_prev, S_new, URHO, 0, 1, 0);
+        amrex::MultiFab::Copy(sdc_prev, S_new, UEDEN, 1, 1, 0);
+        amrex::MultiFab::Copy(sdc_prev, S_new, UFS, 2, NUM_SPECIES, 0);
+      }
+    }
+  }
+
+  if (adaptive) {
+    amrex::Print() << "SDC: level " << level << " used " << sdc_ncycle
+                   << " of " << sdc_iters << " iterations";
+    if (sdc_change >= 0.0) {
+      amrex::Print() << " (last iterate change " << sdc_change << ")";
+    }
+    amrex::Print() << "\n";
   }
 
   finalize_sdc_advance(time, dt, amr_iteration, amr_ncycle);
@@ -233,6 +271,59 @@ PeleC::do_sdc_advance(
   return dt_new;
 }
 
+amrex::Real
+PeleC::sdc_iterate_change(const amrex::MultiFab& prev)
+{
+  BL_PROFILE("PeleC::sdc_iterate_change()");
+
+  const amrex::MultiFab& S_new = get_new_data(State_Type);
+
+  // Changes of rho, rhoY and rhoE, and the scales of rho and rhoE
+  amrex::ReduceOps<
+    amrex::ReduceOpMax, amrex::ReduceOpMax, amrex::ReduceOpMax,
+    amrex::ReduceOpMax, amrex::ReduceOpMax>
+    reduce_op;
+  amrex::ReduceData<
+    amrex::Real, amrex::Real, amrex::Real, amrex::Real, amrex::Real>
+    reduce_data(reduce_op);
+  using ReduceTuple = typename decltype(reduce_data)::Type;
+
+#ifdef AMREX_USE_OMP
+#pragma omp parallel if (amrex::Gpu::notInLaunchRegion())
+#endif
+  for (amrex::MFIter mfi(S_new, amrex::TilingIfNotGPU()); mfi.isValid();
+       ++mfi) {
+    const amrex::Box& bx = mfi.tilebox();
+    auto const& sarr = S_new.const_array(mfi);
+    auto const& parr = prev.const_array(mfi);
+    reduce_op.eval(
+      bx, reduce_data,
+      [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept -> ReduceTuple {
+        amrex::Real drhoY = 0.0;
+        for (int n = 0; n < NUM_SPECIES; n++) {
+          drhoY = amrex::max(
+            drhoY, std::abs(sarr(i, j, k, UFS + n) - parr(i, j, k, 2 + n)));
+        }
+        return {
+          std::abs(sarr(i, j, k, URHO) - parr(i, j, k, 0)), drhoY,
+          std::abs(sarr(i, j, k, UEDEN) - parr(i, j, k, 1)),
+          std::abs(sarr(i, j, k, URHO)), std::abs(sarr(i, j, k, UEDEN))};
+      });
+  }
+
+  ReduceTuple hv = reduce_data.value(reduce_op);
+  amrex::Real change[5] = {
+    amrex::get<0>(hv), amrex::get<1>(hv), amrex::get<2>(hv),
+    amrex::get<3>(hv), amrex::get<4>(hv)};
+  amrex::ParallelDescriptor::ReduceRealMax(change, 5);
+
+  const amrex::Real tiny = std::numeric_limits<amrex::Real>::min();
+  const amrex::Real rho_scale = amrex::max(change[3], tiny);
+  const amrex::Real rhoE_scale = amrex::max(change[4], tiny);
+  return amrex::max(
+    change[0] / rho_scale, change[1] / rho_scale, change[2] / rhoE_scale);
+}
+
 amrex::Real
 PeleC::do_sdc_iteration(
   amrex::Real time,
@@ -275,8 +366,21 @@ PeleC::do_sdc_iteration(
   }
 #endif
 
-  if (fill_Sborder) {
+  // Get diffusion source separate from other sources, since it requires grow
+  // cells, and we may want to reuse what we fill-patched for hydro. It is
+  // computed along with the fill so the two can overlap.
+  if ((sub_iteration == 0) && do_diffuse) {
+    if (verbose != 0) {
+      amrex::Print() << "... Computing diffusion terms at t^(n)" << std::endl;
+    }
+    AMREX_ASSERT(
+      !do_mol); // Currently this combo only managed through MOL integrator
+    amrex::Real flux_factor_old = 0.5;
+    fill_sborder_mol_src(
+      time, nGrow_FP_border, *old_sources[diff_src], dt, flux_factor_old);
+  } else if (fill_Sborder) {
     FillPatcherFill(Sborder, 0, NVAR, nGrow_FP_border, time, State_Type, 0);
+    reset_primitive_cache(Sborder, nGrow_FP_border, time);
   }
 
   if (sub_iteration == 0) {
@@ -290,19 +394,6 @@ PeleC::do_sdc_iteration(
       }
     }
 
-    // Get diffusion source separate from other sources, since it requires grow
-    // cells, and we may want to reuse what we fill-patched for hydro
-    if (do_diffuse) {
-      if (verbose != 0) {
-        amrex::Print() << "... Computing diffusion terms at t^(n)" << std::endl;
-      }
-      AMREX_ASSERT(
-        !do_mol); // Currently this combo only managed through MOL integrator
-      amrex::Real flux_factor_old = 0.5;
-
-      getMOLSrcTerm(Sborder, *old_sources[diff_src], time, dt, flux_factor_old);
-    }
-
     // Initialize sources at t_new by copying from t_old
     for (int n = 0; n < src_list.size(); ++n) {
       amrex::MultiFab::Copy(
@@ -317,19 +408,13 @@ PeleC::do_sdc_iteration(
   }
 
   // Construct S_new with current iterate of all sources
-  construct_Snew(S_new, S_old, dt);
-
-  int ng_src = 0;
-  computeTemp(S_new, ng_src);
+  construct_Snew(S_new, S_old, dt, true);
 
   // Now update t_new sources (diffusion separate because it requires a fill
   // patch)
-  if (do_diffuse || do_spray_particles) {
-    int nGrowDiff = numGrow();
-    if (do_spray_particles && level > 0) {
-      nGrowDiff = amrex::max(nGrowDiff, nGrow_FP_border);
-    }
-    FillPatcherFill(Sborder, 0, NVAR, nGrowDiff, time + dt, State_Type, 0);
+  int nGrowDiff = numGrow();
+  if (do_spray_particles && level > 0) {
+    nGrowDiff = amrex::max(nGrowDiff, nGrow_FP_border);
   }
   if (do_diffuse) {
     if (verbose != 0) {
@@ -337,7 +422,11 @@ PeleC::do_sdc_iteration(
                      << sub_iteration + 1 << ")" << std::endl;
     }
     amrex::Real flux_factor_new = sub_iteration == sub_ncycle - 1 ? 0.5 : 0;
-    getMOLSrcTerm(Sborder, *new_sources[diff_src], time, dt, flux_factor_new);
+    fill_sborder_mol_src(
+      time + dt, nGrowDiff, *new_sources[diff_src], dt, flux_factor_new);
+  } else if (do_spray_particles) {
+    FillPatcherFill(Sborder, 0, NVAR, nGrowDiff, time + dt, State_Type, 0);
+    reset_primitive_cache(Sborder, nGrowDiff, time + dt);
   }
 
   // Build other (non-diffusion) sources at t_new
@@ -352,13 +441,12 @@ PeleC::do_sdc_iteration(
   // Update I_R and rebuild S_new accordingly
   if (do_react) {
     react_state(time, dt);
+    computeTemp(S_new, 0);
   } else {
-    construct_Snew(S_new, S_old, dt);
+    construct_Snew(S_new, S_old, dt, true);
     get_new_data(Reactions_Type).setVal(0);
   }
 
-  computeTemp(S_new, ng_src);
-
   finalize_sdc_iteration(
     time, dt, amr_iteration, amr_ncycle, sub_iteration, sub_ncycle);
 
@@ -367,26 +455,29 @@ PeleC::do_sdc_iteration(
 
 void
 PeleC::construct_Snew(
-  amrex::MultiFab& S_new, const amrex::MultiFab& S_old, amrex::Real dt)
+  amrex::MultiFab& S_new,
+  const amrex::MultiFab& S_old,
+  amrex::Real dt,
+  const bool compute_temp)
 {
   int ng = 0;
 
-  amrex::MultiFab::Copy(S_new, S_old, 0, 0, NVAR, ng);
+  amrex::Vector<StateUpdateTerm> terms{{&S_old, 1.0, 0, 0, NVAR}};
   for (int n = 0; n < src_list.size(); ++n) {
-    amrex::MultiFab::Saxpy(
-      S_new, 0.5 * dt, *new_sources[src_list[n]], 0, 0, NVAR, ng);
-    amrex::MultiFab::Saxpy(
-      S_new, 0.5 * dt, *old_sources[src_list[n]], 0, 0, NVAR, ng);
+    terms.push_back({new_sources[src_list[n]].get(), 0.5 * dt, 0, 0, NVAR});
+    terms.push_back({old_sources[src_list[n]].get(), 0.5 * dt, 0, 0, NVAR});
   }
   if (do_hydro) {
-    amrex::MultiFab::Saxpy(S_new, dt, hydro_source, 0, 0, NVAR, ng);
+    terms.push_back({&hydro_source, dt, 0, 0, NVAR});
   }
 
   if (do_react) {
     const amrex::MultiFab& I_R = get_new_data(Reactions_Type);
-    amrex::MultiFab::Saxpy(S_new, dt, I_R, 0, FirstSpec, NUM_SPECIES, 0);
-    amrex::MultiFab::Saxpy(S_new, dt, I_R, NUM_SPECIES, Eden, 1, 0);
+    terms.push_back({&I_R, dt, 0, FirstSpec, NUM_SPECIES});
+    terms.push_back({&I_R, dt, NUM_SPECIES, Eden, 1});
   }
+
+  fused_state_update(S_new, terms, ng, compute_temp);
 }
 
 void
@@ -1,20 +1,54 @@
 #include <AMReX_FArrayBox.H>
 #include <AMReX_Geometry.H>
+#include <AMReX_ParallelDescriptor.H>
 #include <AMReX_PhysBCFunct.H>
 
 #include "PeleC.H"
 #include "prob.H"
 
+using InflowPlanes =
+  amrex::GpuArray<amrex::Array4<amrex::Real const>, 2 * AMREX_SPACEDIM>;
+
 struct PCHypFillExtDir
 {
   ProbParmDevice const* lprobparm;
   bool m_do_turb_inflow{false};
+  // Problem inflow planes of each face (null where there is none)
+  InflowPlanes m_planes;
 
   AMREX_GPU_HOST
-  constexpr explicit PCHypFillExtDir(
-    const ProbParmDevice* d_prob_parm, const bool do_turb_inflow)
-    : lprobparm(d_prob_parm), m_do_turb_inflow(do_turb_inflow)
+  explicit PCHypFillExtDir(
+    const ProbParmDevice* d_prob_parm,
+    const bool do_turb_inflow,
+    const InflowPlanes& planes)
+    : lprobparm(d_prob_parm), m_do_turb_inflow(do_turb_inflow), m_planes(planes)
+  {
+  }
+
+  // Preload the velocities of the problem inflow plane of face into s_ext,
+  // projecting iv onto the first ghost layer at index ghost. If s_ext holds
+  // the turbulent inflow fluctuation (turb), the plane velocities are added
+  // to it, so a problem can use both a mean inflow plane and turb_inflow.
+  AMREX_GPU_DEVICE
+  void load_plane(
+    const amrex::IntVect& iv,
+    const int idir,
+    const int face,
+    const int ghost,
+    const bool turb,
+    amrex::Real s_ext[NVAR]) const
   {
+    const auto& plane = m_planes[face];
+    if (plane) {
+      amrex::IntVect piv = iv;
+      piv[idir] = ghost;
+      const amrex::Dim3 p = piv.dim3();
+      if (plane.contains(p.x, p.y, p.z)) {
+        for (int n = 0; n < AMREX_SPACEDIM; n++) {
+          s_ext[UMX + n] = (turb ? s_ext[UMX + n] : 0.0) + plane(piv, n);
+        }
+      }
+    }
   }
 
   AMREX_GPU_DEVICE
@@ -50,11 +84,13 @@ struct PCHypFillExtDir
       for (int n = 0; n < NVAR; n++) {
         s_int[n] = dest(loc, n);
       }
-      if (m_do_turb_inflow && (iv[idir] == domlo[idir] - 1)) {
+      const bool turb = m_do_turb_inflow && (iv[idir] == domlo[idir] - 1);
+      if (turb) {
         for (int n = 0; n < NVAR; n++) {
           s_ext[n] = dest(iv, n);
         }
       }
+      load_plane(iv, idir, idir, domlo[idir] - 1, turb, s_ext);
       bcnormal(x, s_int, s_ext, idir, +1, time, geom, *lprobparm);
       for (int n = 0; n < NVAR; n++) {
         dest(iv, n) = s_ext[n];
@@ -66,11 +102,14 @@ struct PCHypFillExtDir
       for (int n = 0; n < NVAR; n++) {
         s_int[n] = dest(loc, n);
       }
-      if (m_do_turb_inflow && (iv[idir] == domlo[idir] - 1)) {
+      const bool turb = m_do_turb_inflow && (iv[idir] == domlo[idir] - 1);
+      if (turb) {
         for (int n = 0; n < NVAR; n++) {
           s_ext[n] = dest(iv, n);
         }
       }
+      load_plane(
+        iv, idir, idir + AMREX_SPACEDIM, domhi[idir] + 1, turb, s_ext);
       bcnormal(x, s_int, s_ext, idir, -1, time, geom, *lprobparm);
       for (int n = 0; n < NVAR; n++) {
         dest(iv, n) = s_ext[n];
@@ -84,11 +123,13 @@ struct PCHypFillExtDir
       for (int n = 0; n < NVAR; n++) {
         s_int[n] = dest(loc, n);
       }
-      if (m_do_turb_inflow && (iv[idir] == domlo[idir] - 1)) {
+      const bool turb = m_do_turb_inflow && (iv[idir] == domlo[idir] - 1);
+      if (turb) {
         for (int n = 0; n < NVAR; n++) {
           s_ext[n] = dest(iv, n);
         }
       }
+      load_plane(iv, idir, idir, domlo[idir] - 1, turb, s_ext);
       bcnormal(x, s_int, s_ext, idir, +1, time, geom, *lprobparm);
       for (int n = 0; n < NVAR; n++) {
         dest(iv, n) = s_ext[n];
@@ -100,11 +141,14 @@ struct PCHypFillExtDir
       for (int n = 0; n < NVAR; n++) {
         s_int[n] = dest(loc, n);
       }
-      if (m_do_turb_inflow && (iv[idir] == domhi[idir] + 1)) {
+      const bool turb = m_do_turb_inflow && (iv[idir] == domhi[idir] + 1);
+      if (turb) {
         for (int n = 0; n < NVAR; n++) {
           s_ext[n] = dest(iv, n);
         }
       }
+      load_plane(
+        iv, idir, idir + AMREX_SPACEDIM, domhi[idir] + 1, turb, s_ext);
       bcnormal(x, s_int, s_ext, idir, -1, time, geom, *lprobparm);
       for (int n = 0; n < NVAR; n++) {
         dest(iv, n) = s_ext[n];
@@ -118,11 +162,13 @@ struct PCHypFillExtDir
       for (int n = 0; n < NVAR; n++) {
         s_int[n] = dest(loc, n);
       }
-      if (m_do_turb_inflow && (iv[idir] == domhi[idir] + 1)) {
+      const bool turb = m_do_turb_inflow && (iv[idir] == domhi[idir] + 1);
+      if (turb) {
         for (int n = 0; n < NVAR; n++) {
           s_ext[n] = dest(iv, n);
         }
       }
+      load_plane(iv, idir, idir, domlo[idir] - 1, turb, s_ext);
       bcnormal(x, s_int, s_ext, idir, +1, time, geom, *lprobparm);
       for (int n = 0; n < NVAR; n++) {
         dest(iv, n) = s_ext[n];
@@ -134,11 +180,14 @@ struct PCHypFillExtDir
       for (int n = 0; n < NVAR; n++) {
         s_int[n] = dest(loc, n);
       }
-      if (m_do_turb_inflow && (iv[idir] == domhi[idir] + 1)) {
+      const bool turb = m_do_turb_inflow && (iv[idir] == domhi[idir] + 1);
+      if (turb) {
         for (int n = 0; n < NVAR; n++) {
           s_ext[n] = dest(iv, n);
         }
       }
+      load_plane(
+        iv, idir, idir + AMREX_SPACEDIM, domhi[idir] + 1, turb, s_ext);
       bcnormal(x, s_int, s_ext, idir, -1, time, geom, *lprobparm);
       for (int n = 0; n < NVAR; n++) {
         dest(iv, n) = s_ext[n];
@@ -178,45 +227,70 @@ pc_bcfill_hyp(
   const int bcomp,
   const int scomp)
 {
+  BL_PROFILE("pc_bcfill_hyp()");
+  const amrex::Real strt =
+    PeleC::time_bcfill_hyp ? amrex::ParallelDescriptor::second() : 0.0;
 
-  if (PeleC::turb_inflow.is_initialized()) {
-    for (int dir = 0; dir < AMREX_SPACEDIM; ++dir) {
-      auto bndryBoxLO = amrex::Box(amrex::adjCellLo(geom.Domain(), dir) & bx);
-      if (bcr[1].lo()[dir] == EXT_DIR && bndryBoxLO.ok()) {
-        // Create box with ghost cells and set them to zero
-        amrex::IntVect growVect(PeleC::numGrow());
-        growVect[dir] = 0;
-        const amrex::Box modDom = amrex::grow(geom.Domain(), growVect);
-        const auto bndryBoxLO_ghost =
-          amrex::Box(amrex::adjCellLo(modDom, dir) & bx);
-        data.setVal<amrex::RunOn::Device>(
-          0.0, bndryBoxLO_ghost, UMX, AMREX_SPACEDIM);
-
-        PeleC::turb_inflow.add_turb(
-          bndryBoxLO, data, UMX, geom, time, dir, amrex::Orientation::low);
-      }
-
-      auto bndryBoxHI = amrex::Box(amrex::adjCellHi(geom.Domain(), dir) & bx);
-      if (bcr[1].hi()[dir] == EXT_DIR && bndryBoxHI.ok()) {
-        // Create box with ghost cells and set them to zero
-        amrex::IntVect growVect(PeleC::numGrow());
-        growVect[dir] = 0;
-        const amrex::Box modDom = amrex::grow(geom.Domain(), growVect);
-        const auto bndryBoxHI_ghost =
-          amrex::Box(amrex::adjCellHi(modDom, dir) & bx);
-        data.setVal<amrex::RunOn::Device>(
-          0.0, bndryBoxHI_ghost, UMX, AMREX_SPACEDIM);
-
-        PeleC::turb_inflow.add_turb(
-          bndryBoxHI, data, UMX, geom, time, dir, amrex::Orientation::high);
+  // The turbulent inflow and problem inflow planes do not depend on the
+  // state, so they are evaluated once per time and face and then reused
+  const bool do_turb_inflow = PeleC::turb_inflow_planes.active();
+  const bool do_prob_planes = PeleC::prob_inflow_planes.active();
+  InflowPlanes planes;
+  amrex::Array<amrex::FArrayBox, 2 * AMREX_SPACEDIM> turb_scratch;
+  amrex::Array<amrex::FArrayBox, 2 * AMREX_SPACEDIM> plane_scratch;
+  if (do_turb_inflow || do_prob_planes) {
+    for (amrex::OrientationIter oit; oit.isValid(); ++oit) {
+      const amrex::Orientation face = oit();
+      const int dir = face.coordDir();
+      const int bctype = face.isLow() ? bcr[1].lo()[dir] : bcr[1].hi()[dir];
+      if (bctype != EXT_DIR) {
+        continue;
+      }
+
+      // Ghost cells next to the face, including the tangential ghost cells
+      amrex::IntVect growVect(PeleC::numGrow());
+      growVect[dir] = 0;
+      const amrex::Box modDom = amrex::grow(geom.Domain(), growVect);
+      const amrex::Box bndryBox_ghost = amrex::adjCell(modDom, face) & bx;
+      if (!bndryBox_ghost.ok()) {
+        continue;
+      }
+
+      if (do_turb_inflow) {
+        const auto bndryBox =
+          amrex::Box(amrex::adjCell(geom.Domain(), face) & bx);
+        if (bndryBox.ok()) {
+          data.setVal<amrex::RunOn::Device>(
+            0.0, bndryBox_ghost, UMX, AMREX_SPACEDIM);
+          const amrex::FArrayBox& turb = PeleC::turb_inflow_planes.get(
+            bndryBox, geom, time, face, turb_scratch[face]);
+          data.copy<amrex::RunOn::Device>(
+            turb, bndryBox, 0, bndryBox, UMX, AMREX_SPACEDIM);
+        }
+      }
+
+      if (do_prob_planes) {
+        planes[face] =
+          PeleC::prob_inflow_planes
+            .get(bndryBox_ghost, geom, time, face, plane_scratch[face])
+            .const_array();
       }
     }
   }
 
   const ProbParmDevice* lprobparm = PeleC::d_prob_parm_device;
   amrex::GpuBndryFuncFab<PCHypFillExtDir> hyp_bndry_func(
-    PCHypFillExtDir{lprobparm, PeleC::turb_inflow.is_initialized()});
+    PCHypFillExtDir{lprobparm, do_turb_inflow, planes});
   hyp_bndry_func(bx, data, dcomp, numcomp, geom, time, bcr, bcomp, scomp);
+
+  if (PeleC::time_bcfill_hyp) {
+    amrex::Gpu::streamSynchronize();
+    const amrex::Real elapsed = amrex::ParallelDescriptor::second() - strt;
+#ifdef AMREX_USE_OMP
+#pragma omp atomic
+#endif
+    PeleC::bcfill_hyp_time += elapsed;
+  }
 }
 
 void
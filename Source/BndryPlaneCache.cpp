@@ -0,0 +1,101 @@
+#include <algorithm>
+
+#include <AMReX_ParallelDescriptor.H>
+#include <AMReX_Print.H>
+
+#include "BndryPlaneCache.H"
+
+const amrex::FArrayBox&
+BndryPlaneCache::get(
+  const amrex::Box& plane,
+  const amrex::Geometry& geom,
+  const amrex::Real time,
+  const amrex::Orientation face,
+  amrex::FArrayBox& scratch)
+{
+  AMREX_ASSERT(active());
+
+  amrex::FArrayBox* fab = &scratch;
+  bool need_fill = true;
+#ifdef AMREX_USE_OMP
+#pragma omp critical(pc_bndry_plane_cache)
+#endif
+  {
+    if (m_cache) {
+      evict(geom.Domain(), time);
+      const Key key{geom.Domain(), static_cast<int>(face), plane, time};
+      auto it = m_planes.find(key);
+      need_fill = (it == m_planes.end());
+      if (need_fill) {
+        it = m_planes.emplace(key, amrex::FArrayBox()).first;
+        m_misses++;
+      } else {
+        m_hits++;
+      }
+      fab = &(it->second);
+    } else {
+      m_misses++;
+    }
+
+    // Misses are evaluated while holding the lock so that other threads
+    // never see a plane that is still being filled
+    if (need_fill) {
+      const amrex::Real strt = amrex::ParallelDescriptor::second();
+      // A scratch plane must outlive the boundary kernels that read it
+      fab->resize(
+        plane, ncomp, m_cache ? amrex::The_Arena() : amrex::The_Async_Arena());
+      fab->setVal<amrex::RunOn::Device>(0.0);
+      m_fill(plane, *fab, geom, time, face);
+      amrex::Gpu::streamSynchronize();
+      m_fill_time += amrex::ParallelDescriptor::second() - strt;
+    }
+  }
+  return *fab;
+}
+
+void
+BndryPlaneCache::evict(const amrex::Box& domain, const amrex::Real time)
+{
+  auto& times = m_times[domain];
+  if (std::find(times.begin(), times.end(), time) != times.end()) {
+    return;
+  }
+  times.push_back(time);
+  if (static_cast<int>(times.size()) <= ntimes) {
+    return;
+  }
+
+  const amrex::Real oldest = times[0];
+  times.erase(times.begin());
+  for (auto it = m_planes.begin(); it != m_planes.end();) {
+    const auto& key = it->first;
+    if ((std::get<0>(key) == domain) && (std::get<3>(key) == oldest)) {
+      it = m_planes.erase(it);
+    } else {
+      ++it;
+    }
+  }
+}
+
+void
+BndryPlaneCache::clear()
+{
+  m_planes.clear();
+  m_times.clear();
+}
+
+void
+BndryPlaneCache::print_stats(const std::string& name) const
+{
+  amrex::Long hits = m_hits;
+  amrex::Long misses = m_misses;
+  amrex::Real fill_time = m_fill_time;
+  const int IOProc = amrex::ParallelDescriptor::IOProcessorNumber();
+  amrex::ParallelDescriptor::ReduceLongSum(hits, IOProc);
+  amrex::ParallelDescriptor::ReduceLongSum(misses, IOProc);
+  amrex::ParallelDescriptor::ReduceRealMax(fill_time, IOProc);
+
+  amrex::Print() << name << " boundary planes: " << hits << " hits, "
+                 << misses << " evaluations in " << fill_time << " s"
+                 << std::endl;
+}
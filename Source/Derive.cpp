@@ -1,3 +1,5 @@
+#include <map>
+
 #include "mechanism.H"
 
 #include "PelePhysics.H"
@@ -882,6 +884,191 @@ PeleC::pc_derdiffusivity(
   });
 }
 
+int
+pc_fused_derive_id(const std::string& name)
+{
+  static const std::map<std::string, int> fused_ids = {
+    {"pressure", FD_PRES},
+    {"kineng", FD_KINENG},
+    {"soundspeed", FD_SOUNDSPEED},
+    {"MachNumber", FD_MACH},
+    {"entropy", FD_ENTROPY},
+    {"eint_E", FD_EINT_E},
+    {"eint_e", FD_EINT_RHOE},
+    {"logden", FD_LOGDEN},
+    {"massfrac", FD_MASSFRAC},
+    {"molefrac", FD_MOLEFRAC},
+    {"x_velocity", FD_VELX},
+    {"y_velocity", FD_VELY},
+    {"z_velocity", FD_VELZ},
+    {"magvel", FD_MAGVEL},
+    {"magmom", FD_MAGMOM},
+    {"cp", FD_CP},
+    {"cv", FD_CV},
+    {"viscosity", FD_VISC},
+    {"bulk_viscosity", FD_BULKVISC},
+    {"conductivity", FD_COND},
+    {"diffusivity", FD_DIFF}};
+
+  const auto it = fused_ids.find(name);
+  return it == fused_ids.end() ? -1 : it->second;
+}
+
+void
+PeleC::derivePlotFused(
+  const amrex::Vector<std::pair<int, int>>& fused, amrex::MultiFab& dest)
+{
+  if (fused.empty()) {
+    return;
+  }
+
+  // Destination component of each fused derive, -1 if not requested
+  amrex::GpuArray<int, FD_NUM> dc;
+  for (int n = 0; n < FD_NUM; n++) {
+    dc[n] = -1;
+  }
+  for (const auto& f : fused) {
+    AMREX_ASSERT(f.first >= 0 && f.first < FD_NUM);
+    dc[f.first] = f.second;
+  }
+
+  // Transport is evaluated at most once per cell for all requested
+  // coefficients
+  const bool get_xi = dc[FD_BULKVISC] >= 0;
+  const bool get_mu = dc[FD_VISC] >= 0;
+  const bool get_lam = dc[FD_COND] >= 0;
+  const bool get_Ddiag = dc[FD_DIFF] >= 0;
+  const bool need_trans = get_xi || get_mu || get_lam || get_Ddiag;
+  const bool need_cs = (dc[FD_SOUNDSPEED] >= 0) || (dc[FD_MACH] >= 0);
+
+  const amrex::MultiFab& S = get_new_data(State_Type);
+  auto const* ltransparm = trans_parms.device_trans_parm();
+
+#ifdef AMREX_USE_OMP
+#pragma omp parallel if (amrex::Gpu::notInLaunchRegion())
+#endif
+  for (amrex::MFIter mfi(dest, amrex::TilingIfNotGPU()); mfi.isValid();
+       ++mfi) {
+    const amrex::Box& bx = mfi.tilebox();
+    auto const& dat = S.const_array(mfi);
+    auto const& der = dest.array(mfi);
+
+    amrex::ParallelFor(bx, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
+      const amrex::Real rho = dat(i, j, k, URHO);
+      const amrex::Real rhoInv = 1.0 / rho;
+      const amrex::Real T = dat(i, j, k, UTEMP);
+      const amrex::Real mx = dat(i, j, k, UMX);
+      const amrex::Real my = dat(i, j, k, UMY);
+      const amrex::Real mz = dat(i, j, k, UMZ);
+      const amrex::Real msq = mx * mx + my * my + mz * mz;
+      const amrex::Real ux = mx * rhoInv;
+      const amrex::Real uy = my * rhoInv;
+      const amrex::Real uz = mz * rhoInv;
+      const amrex::Real usq = ux * ux + uy * uy + uz * uz;
+
+      amrex::Real massfrac[NUM_SPECIES];
+      for (int n = 0; n < NUM_SPECIES; n++) {
+        massfrac[n] = dat(i, j, k, UFS + n) * rhoInv;
+      }
+      auto eos = pele::physics::PhysicsType::eos();
+
+      if (dc[FD_PRES] >= 0) {
+        amrex::Real p;
+        eos.RTY2P(rho, T, massfrac, p);
+        der(i, j, k, dc[FD_PRES]) = p;
+      }
+      if (dc[FD_KINENG] >= 0) {
+        der(i, j, k, dc[FD_KINENG]) = 0.5 / rho * msq;
+      }
+      if (need_cs) {
+        amrex::Real c;
+        eos.RTY2Cs(rho, T, massfrac, c);
+        if (dc[FD_SOUNDSPEED] >= 0) {
+          der(i, j, k, dc[FD_SOUNDSPEED]) = c;
+        }
+        if (dc[FD_MACH] >= 0) {
+          der(i, j, k, dc[FD_MACH]) = sqrt(msq) / rho / c;
+        }
+      }
+      if (dc[FD_ENTROPY] >= 0) {
+        amrex::Real s;
+        eos.S(s);
+        der(i, j, k, dc[FD_ENTROPY]) = s;
+      }
+      if (dc[FD_EINT_E] >= 0) {
+        der(i, j, k, dc[FD_EINT_E]) =
+          dat(i, j, k, UEDEN) * rhoInv - 0.5 * usq;
+      }
+      if (dc[FD_EINT_RHOE] >= 0) {
+        der(i, j, k, dc[FD_EINT_RHOE]) = dat(i, j, k, UEINT) / rho;
+      }
+      if (dc[FD_LOGDEN] >= 0) {
+        der(i, j, k, dc[FD_LOGDEN]) = log10(rho);
+      }
+      if (dc[FD_MASSFRAC] >= 0) {
+        for (int n = 0; n < NUM_SPECIES; n++) {
+          der(i, j, k, dc[FD_MASSFRAC] + n) = dat(i, j, k, UFS + n) / rho;
+        }
+      }
+      if (dc[FD_MOLEFRAC] >= 0) {
+        amrex::Real mole[NUM_SPECIES];
+        eos.Y2X(massfrac, mole);
+        for (int n = 0; n < NUM_SPECIES; n++) {
+          der(i, j, k, dc[FD_MOLEFRAC] + n) = mole[n];
+        }
+      }
+      if (dc[FD_VELX] >= 0) {
+        der(i, j, k, dc[FD_VELX]) = mx / rho;
+      }
+      if (dc[FD_VELY] >= 0) {
+        der(i, j, k, dc[FD_VELY]) = my / rho;
+      }
+      if (dc[FD_VELZ] >= 0) {
+        der(i, j, k, dc[FD_VELZ]) = mz / rho;
+      }
+      if (dc[FD_MAGVEL] >= 0) {
+        der(i, j, k, dc[FD_MAGVEL]) = sqrt(usq);
+      }
+      if (dc[FD_MAGMOM] >= 0) {
+        der(i, j, k, dc[FD_MAGMOM]) = sqrt(msq);
+      }
+      if (dc[FD_CP] >= 0) {
+        amrex::Real cp = 0.0;
+        eos.RTY2Cp(rho, T, massfrac, cp);
+        der(i, j, k, dc[FD_CP]) = cp;
+      }
+      if (dc[FD_CV] >= 0) {
+        amrex::Real cv = 0.0;
+        eos.RTY2Cv(rho, T, massfrac, cv);
+        der(i, j, k, dc[FD_CV]) = cv;
+      }
+      if (need_trans) {
+        auto trans = pele::physics::PhysicsType::transport();
+        amrex::Real ddiag[NUM_SPECIES] = {0.0};
+        amrex::Real mu = 0.0, xi = 0.0, lam = 0.0;
+        const bool get_chi = false;
+        trans.transport(
+          get_xi, get_mu, get_lam, get_Ddiag, get_chi, T, rho, massfrac,
+          get_Ddiag ? ddiag : nullptr, nullptr, mu, xi, lam, ltransparm);
+        if (get_mu) {
+          der(i, j, k, dc[FD_VISC]) = mu;
+        }
+        if (get_xi) {
+          der(i, j, k, dc[FD_BULKVISC]) = xi;
+        }
+        if (get_lam) {
+          der(i, j, k, dc[FD_COND]) = lam;
+        }
+        if (get_Ddiag) {
+          for (int n = 0; n < NUM_SPECIES; n++) {
+            der(i, j, k, dc[FD_DIFF] + n) = ddiag[n];
+          }
+        }
+      }
+    });
+  }
+}
+
 #ifdef PELEC_USE_MASA
 void
 pc_derrhommserror(
@@ -1,12 +1,216 @@
 #include "Diffusion.H"
 
+namespace {
+// The part of tile bx of the grid vbx that belongs to region, where the
+// interior of the grid is at least ng cells away from its boundary
+amrex::BoxList
+mol_region_boxes(
+  const amrex::Box& bx, const amrex::Box& vbx, const int ng, MOLRegion region)
+{
+  if (region == MOL_ALL) {
+    return amrex::BoxList(bx);
+  }
+  const amrex::Box inner = bx & amrex::grow(vbx, -ng);
+  if (region == MOL_INTERIOR) {
+    return inner.ok() ? amrex::BoxList(inner) : amrex::BoxList();
+  }
+  return inner.ok() ? amrex::boxDiff(bx, inner) : amrex::BoxList(bx);
+}
+} // namespace
+
+// Record that S has just been filled with ng grow cells at time, so anything
+// cached from its previous contents is stale
+void
+PeleC::reset_primitive_cache(
+  const amrex::MultiFab& S, const int ng, const amrex::Real time)
+{
+  prim_state = &S;
+  prim_ng = ng;
+  prim_time = time;
+  prim_q_valid = false;
+  prim_coeff_valid = false;
+  prim_valid_cells = false;
+  sborder_holds_new_state = false;
+}
+
+bool
+PeleC::primitive_cache_matches(const amrex::Real time, const int ng) const
+{
+  return (prim_state == &Sborder) && (prim_time == time) && (ng <= prim_ng);
+}
+
+void
+PeleC::clear_primitive_cache()
+{
+  prim_q.clear();
+  prim_qaux.clear();
+  prim_coeff.clear();
+  prim_state = nullptr;
+  prim_ng = -1;
+  prim_q_valid = false;
+  prim_coeff_valid = false;
+  prim_valid_cells = false;
+  sborder_holds_new_state = false;
+}
+
+// Compute Q, Qaux and (optionally) the transport coefficients from S over
+// its valid region and prim_ng grow cells. Whatever is still valid from an
+// earlier call for the same fill of S is reused; the transport coefficients
+// are evaluated tile by tile right after the primitive state. With valid_only,
+// everything is computed on the valid cells only, so that the grow cells of
+// S can still be in flight.
+void
+PeleC::build_primitive_cache(
+  const amrex::MultiFab& S,
+  const int ng,
+  const bool need_coeffs,
+  const bool valid_only)
+{
+  if ((&S != prim_state) || (ng > prim_ng)) {
+    // S was not registered through reset_primitive_cache (or not with enough
+    // grow cells), so it cannot be matched by time by other consumers
+    reset_primitive_cache(S, ng, std::numeric_limits<amrex::Real>::lowest());
+  }
+
+  const bool do_prim = !prim_q_valid;
+  const bool do_coeffs = need_coeffs && !prim_coeff_valid;
+  if ((!do_prim && !do_coeffs) || (valid_only && prim_valid_cells)) {
+    return;
+  }
+  AMREX_ASSERT(!valid_only || need_coeffs);
+  const bool skip_valid = prim_valid_cells;
+
+  BL_PROFILE("PeleC::build_primitive_cache()");
+
+  const amrex::BoxArray& ba = S.boxArray();
+  const amrex::DistributionMapping& dm = S.DistributionMap();
+  const int nqaux = NQAUX > 0 ? NQAUX : 1;
+  const int nCompTr = dComp_lambda + 1;
+  if (
+    prim_q.empty() || (prim_q.boxArray() != ba) ||
+    (prim_q.DistributionMap() != dm) || (prim_q.nGrow() < prim_ng)) {
+    prim_q.define(ba, dm, QVAR, prim_ng);
+    prim_qaux.define(ba, dm, nqaux, prim_ng);
+    prim_coeff.clear();
+  }
+  if (
+    need_coeffs && (prim_coeff.empty() || (prim_coeff.boxArray() != ba) ||
+                    (prim_coeff.DistributionMap() != dm) ||
+                    (prim_coeff.nGrow() < prim_ng))) {
+    prim_coeff.define(ba, dm, nCompTr, prim_ng);
+  }
+
+  auto const* ltransparm = trans_parms.device_trans_parm();
+
+#ifdef AMREX_USE_OMP
+#pragma omp parallel if (amrex::Gpu::notInLaunchRegion())
+#endif
+  for (amrex::MFIter mfi(prim_q, amrex::TilingIfNotGPU()); mfi.isValid();
+       ++mfi) {
+    const amrex::Box gbox =
+      valid_only ? mfi.tilebox() : mfi.growntilebox(prim_ng);
+    const amrex::Box vbox = mfi.validbox();
+    auto const& sar = S.const_array(mfi);
+    auto const& qar = prim_q.array(mfi);
+    auto const& qauxar = prim_qaux.array(mfi);
+    amrex::Array4<amrex::Real> qar_yin, qar_Tin, qar_rhoin;
+    amrex::Array4<amrex::Real> coe_rhoD, coe_mu, coe_xi, coe_lambda;
+    if (do_coeffs) {
+      qar_yin = prim_q[mfi].array(QFS);
+      qar_Tin = prim_q[mfi].array(QTEMP);
+      qar_rhoin = prim_q[mfi].array(QRHO);
+      coe_rhoD = prim_coeff[mfi].array(dComp_rhoD);
+      coe_mu = prim_coeff[mfi].array(dComp_mu);
+      coe_xi = prim_coeff[mfi].array(dComp_xi);
+      coe_lambda = prim_coeff[mfi].array(dComp_lambda);
+    }
+    if (do_prim) {
+      amrex::ParallelFor(
+        gbox, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
+          const amrex::IntVect iv(AMREX_D_DECL(i, j, k));
+          if (skip_valid && vbox.contains(iv)) {
+            return;
+          }
+          pc_ctoprim(i, j, k, sar, qar, qauxar);
+        });
+    }
+    if (do_coeffs) {
+      // Whole boxes are handed to the transport model so that its loops
+      // over the cells can vectorize on the CPU
+      BL_PROFILE("PeleC::get_transport_coeffs()");
+      const amrex::BoxList coef_boxes =
+        skip_valid ? amrex::boxDiff(gbox, vbox) : amrex::BoxList(gbox);
+      for (const amrex::Box& cbx : coef_boxes) {
+        amrex::launch(cbx, [=] AMREX_GPU_DEVICE(amrex::Box const& tbx) {
+          auto trans = pele::physics::PhysicsType::transport();
+          trans.get_transport_coeffs(
+            tbx, qar_yin, qar_Tin, qar_rhoin, coe_rhoD,
+            amrex::Array4<amrex::Real>(), coe_mu, coe_xi, coe_lambda,
+            ltransparm);
+        });
+      }
+    }
+  }
+
+  if (valid_only) {
+    prim_valid_cells = true;
+    return;
+  }
+  prim_q_valid = true;
+  prim_coeff_valid = prim_coeff_valid || do_coeffs;
+}
+
+void
+PeleC::fill_sborder_mol_src(
+  const amrex::Real time,
+  const int ng,
+  amrex::MultiFab& MOLSrcTerm,
+  const amrex::Real dt,
+  const amrex::Real flux_factor)
+{
+  BL_PROFILE("PeleC::fill_sborder_mol_src()");
+
+  // Level 0 filled from a single time level of the state is a copy of the
+  // valid cells, a ghost cell exchange and the physical boundary conditions,
+  // so the interior of the grids can be computed while the exchange is in
+  // flight. Finer levels interpolate from the coarse level inside the
+  // FillPatcher, and the flux registers add fluxes by whole tiles, so these
+  // keep the blocking fill.
+  amrex::Vector<amrex::MultiFab*> smf;
+  amrex::Vector<amrex::Real> stime;
+  state[State_Type].getData(smf, stime, time);
+  const bool adds_to_fluxreg =
+    do_reflux && (flux_factor != 0) && (level < parent->finestLevel());
+  const bool overlap = mol_overlap_fill && (level == 0) &&
+                       (smf.size() == 1) && !adds_to_fluxreg;
+
+  if (!overlap) {
+    FillPatcherFill(Sborder, 0, NVAR, ng, time, State_Type, 0);
+    reset_primitive_cache(Sborder, ng, time);
+    getMOLSrcTerm(Sborder, MOLSrcTerm, time, dt, flux_factor);
+    return;
+  }
+
+  amrex::MultiFab::Copy(Sborder, *smf[0], 0, 0, NVAR, 0);
+  reset_primitive_cache(Sborder, ng, time);
+  Sborder.FillBoundary_nowait(
+    0, NVAR, amrex::IntVect(ng), geom.periodicity());
+  getMOLSrcTerm(Sborder, MOLSrcTerm, time, dt, flux_factor, MOL_INTERIOR);
+
+  Sborder.FillBoundary_finish();
+  amrex::StateDataPhysBCFunct physbcf(state[State_Type], 0, geom);
+  physbcf(Sborder, 0, NVAR, amrex::IntVect(ng), time, 0);
+  getMOLSrcTerm(Sborder, MOLSrcTerm, time, dt, flux_factor, MOL_BOUNDARY);
+}
+
 void
 PeleC::getMOLSrcTerm(
   const amrex::MultiFab& S,
   amrex::MultiFab& MOLSrcTerm,
   amrex::Real /*time*/,
   amrex::Real dt,
-  amrex::Real flux_factor)
+  amrex::Real flux_factor,
+  MOLRegion region)
 {
   BL_PROFILE("PeleC::getMOLSrcTerm()");
   if (
@@ -61,8 +265,9 @@ PeleC::getMOLSrcTerm(
      accelerators.
   */
 
-  const int nCompTr = dComp_lambda + 1;
   const int do_harmonic = 1; // TODO: parmparse this
+  const amrex::Real gamma_cache_tol =
+    riemann_gamma_cache ? riemann_gamma_cache_tol : -1.0;
   const amrex::GpuArray<amrex::Real, AMREX_SPACEDIM> dx = geom.CellSizeArray();
 
   amrex::Real dx1 = dx[0];
@@ -83,6 +288,8 @@ PeleC::getMOLSrcTerm(
   prefetchToDevice(S);
   prefetchToDevice(MOLSrcTerm);
 
+  build_primitive_cache(S, numGrow(), true, region == MOL_INTERIOR);
+
   auto const& fact =
     dynamic_cast<amrex::EBFArrayBoxFactory const&>(S.Factory());
   auto const& flags = fact.getMultiEBCellFlagFab();
@@ -108,519 +315,511 @@ PeleC::getMOLSrcTerm(
   {
     for (amrex::MFIter mfi(MOLSrcTerm, amrex::TilingIfNotGPU()); mfi.isValid();
          ++mfi) {
-      const amrex::Box vbox = mfi.tilebox();
-      int ng = numGrow();
-      const amrex::Box gbox = amrex::grow(vbox, ng);
-      const amrex::Box cbox = amrex::grow(vbox, ng - 1);
-      auto const& MOLSrc = MOLSrcTerm.array(mfi);
-
-      amrex::Real wt = amrex::ParallelDescriptor::second();
-      const auto& flag_fab = flags[mfi];
-      amrex::FabType typ = flag_fab.getType(vbox);
-      if (typ == amrex::FabType::covered) {
-        setV(vbox, NVAR, MOLSrc, 0);
-        if (do_mol_load_balance && (cost != nullptr)) {
-          wt = (amrex::ParallelDescriptor::second() - wt) / vbox.d_numPts();
-          (*cost)[mfi].plus<amrex::RunOn::Device>(wt, vbox);
+      const amrex::BoxList vboxes =
+        mol_region_boxes(mfi.tilebox(), mfi.validbox(), numGrow(), region);
+      for (const amrex::Box& vbox : vboxes) {
+        int ng = numGrow();
+        const amrex::Box cbox = amrex::grow(vbox, ng - 1);
+        auto const& MOLSrc = MOLSrcTerm.array(mfi);
+
+        amrex::Real wt = amrex::ParallelDescriptor::second();
+        const auto& flag_fab = flags[mfi];
+        amrex::FabType typ = flag_fab.getType(vbox);
+        if (typ == amrex::FabType::covered) {
+          setV(vbox, NVAR, MOLSrc, 0);
+          if (do_mol_load_balance && (cost != nullptr)) {
+            wt = (amrex::ParallelDescriptor::second() - wt) / vbox.d_numPts();
+            (*cost)[mfi].plus<amrex::RunOn::Device>(wt, vbox);
+          }
+          continue;
         }
-        continue;
-      }
-      // Note on typ: if interior cells (vbox) are all covered, no need to
-      // do anything. But otherwise, we need to do EB stuff if there are any
-      // cut cells within 1 grow cell (cbox) due to EB redistribute
-      typ = flag_fab.getType(cbox);
-
-      // TODO: Add check that this is nextra-1
-      //       (better: fix bounds on ebflux computation in hyperbolic routine
-      //                to be a constant, and make sure this matches it)
-      const amrex::Box ebfluxbox = amrex::grow(vbox, 2);
-
-      const int local_i = mfi.LocalIndex();
-      const auto Ncut =
-        (!eb_in_domain)
-          ? 0
-          : static_cast<int>(sv_eb_bndry_grad_stencil[local_i].size());
-      SparseData<amrex::Real, EBBndrySten> eb_flux_thdlocal;
-      if (Ncut > 0) {
-        eb_flux_thdlocal.define(sv_eb_bndry_grad_stencil[local_i], NVAR);
-      }
-      auto* d_sv_eb_bndry_geom =
-        (Ncut > 0 ? sv_eb_bndry_geom[local_i].data() : nullptr);
-
-      const int nqaux = NQAUX > 0 ? NQAUX : 1;
-      amrex::FArrayBox q(gbox, QVAR, amrex::The_Async_Arena());
-      amrex::FArrayBox qaux(gbox, nqaux, amrex::The_Async_Arena());
-      amrex::FArrayBox coeff_cc(gbox, nCompTr, amrex::The_Async_Arena());
-      auto const& sar = S.array(mfi);
-      auto const& qar = q.array();
-      auto const& qauxar = qaux.array();
-
-      // Get primitives, Q, including (Y, T, p, rho) from conserved state
-      // required for D term
-      {
-        BL_PROFILE("PeleC::ctoprim()");
-        amrex::ParallelFor(
-          gbox, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
-            pc_ctoprim(i, j, k, sar, qar, qauxar);
-          });
-      }
-      // TODO deal with NSCBC
-      /*
-            for (int dir = 0; dir < AMREX_SPACEDIM ; dir++)  {
-              const amrex::Box& bxtmp = amrex::surroundingNodes(vbox,dir);
-              amrex::Box TestBox(bxtmp);
-              for(int d=0; d<AMREX_SPACEDIM; ++d) {
-                if (dir!=d) TestBox.grow(d,1);
+        // Note on typ: if interior cells (vbox) are all covered, no need to
+        // do anything. But otherwise, we need to do EB stuff if there are any
+        // cut cells within 1 grow cell (cbox) due to EB redistribute
+        typ = flag_fab.getType(cbox);
+
+        // Regular tiles (the bulk of the domain even with EB) skip all of the
+        // EB stencils, the intermediate divergence and the redistribution, and
+        // write the flux divergence straight into MOLSrc on the valid cells
+        const bool regular = (typ == amrex::FabType::regular);
+
+        // TODO: Add check that this is nextra-1
+        //       (better: fix bounds on ebflux computation in hyperbolic routine
+        //                to be a constant, and make sure this matches it)
+        const amrex::Box ebfluxbox = amrex::grow(vbox, 2);
+
+        const int local_i = mfi.LocalIndex();
+        const auto Ncut =
+          (!eb_in_domain || regular)
+            ? 0
+            : static_cast<int>(sv_eb_bndry_grad_stencil[local_i].size());
+        SparseData<amrex::Real, EBBndrySten> eb_flux_thdlocal;
+        if (Ncut > 0) {
+          eb_flux_thdlocal.define(sv_eb_bndry_grad_stencil[local_i], NVAR);
+        }
+        auto* d_sv_eb_bndry_geom =
+          (Ncut > 0 ? sv_eb_bndry_geom[local_i].data() : nullptr);
+
+        // Primitives, Q, including (Y, T, p, rho) and the transport
+        // coefficients coincident with Q, required for D term
+        auto const& qar = prim_q.const_array(mfi);
+        auto const& qauxar = prim_qaux.const_array(mfi);
+        auto const& coe_cc = prim_coeff.const_array(mfi);
+        // TODO deal with NSCBC
+        /*
+              for (int dir = 0; dir < AMREX_SPACEDIM ; dir++)  {
+                const amrex::Box& bxtmp = amrex::surroundingNodes(vbox,dir);
+                amrex::Box TestBox(bxtmp);
+                for(int d=0; d<AMREX_SPACEDIM; ++d) {
+                  if (dir!=d) TestBox.grow(d,1);
+                }
+
+                bcMask[dir].resize(TestBox,1, amrex::The_Async_Arena());
+                bcMask[dir].setVal(0);
               }
 
-              bcMask[dir].resize(TestBox,1, amrex::The_Async_Arena());
-              bcMask[dir].setVal(0);
-            }
-
-            // Becase bcMask is read in the Riemann solver in any case,
-            // here we put physbc values in the appropriate faces for the
-         non-nscbc case set_bc_mask(lo, hi, domain_lo, domain_hi,
-                        AMREX_D_DECL(AMREX_TO_FORTRAN(bcMask[0]),
-                               AMREX_TO_FORTRAN(bcMask[1]),
-                               AMREX_TO_FORTRAN(bcMask[2])));
-
-            if (nscbc_diff == 1)
-            {
-              impose_NSCBC(lo, hi, domain_lo, domain_hi,
-                           AMREX_TO_FORTRAN(Sfab),
-                           AMREX_TO_FORTRAN(q.fab()),
-                           AMREX_TO_FORTRAN(qaux.fab()),
-                           AMREX_D_DECL(AMREX_TO_FORTRAN(bcMask[0]),
-                                  AMREX_TO_FORTRAN(bcMask[1]),
-                                  AMREX_TO_FORTRAN(bcMask[2])),
-                           &flag_nscbc_isAnyPerio, flag_nscbc_perio,
-                           &time, dx, &dt);
-            }
-      */
-      // Compute transport coefficients, coincident with Q
-      auto const& coe_cc = coeff_cc.array();
-      {
-        auto const& qar_yin = q.array(QFS);
-        auto const& qar_Tin = q.array(QTEMP);
-        auto const& qar_rhoin = q.array(QRHO);
-        auto const& coe_rhoD = coeff_cc.array(dComp_rhoD);
-        auto const& coe_mu = coeff_cc.array(dComp_mu);
-        auto const& coe_xi = coeff_cc.array(dComp_xi);
-        auto const& coe_lambda = coeff_cc.array(dComp_lambda);
-        BL_PROFILE("PeleC::get_transport_coeffs()");
-        // Get Transport coefs on GPU.
-        auto const* ltransparm = trans_parms.device_trans_parm();
-        amrex::launch(gbox, [=] AMREX_GPU_DEVICE(amrex::Box const& tbx) {
-          auto trans = pele::physics::PhysicsType::transport();
-          trans.get_transport_coeffs(
-            tbx, qar_yin, qar_Tin, qar_rhoin, coe_rhoD,
-            amrex::Array4<amrex::Real>(), coe_mu, coe_xi, coe_lambda,
-            ltransparm);
-        });
-      }
-
-      amrex::FArrayBox flux_ec[AMREX_SPACEDIM];
-      const amrex::Box eboxes[AMREX_SPACEDIM] = {AMREX_D_DECL(
-        amrex::surroundingNodes(cbox, 0), amrex::surroundingNodes(cbox, 1),
-        amrex::surroundingNodes(cbox, 2))};
-      amrex::GpuArray<amrex::Array4<amrex::Real>, AMREX_SPACEDIM> flx;
-      const amrex::GpuArray<
-        const amrex::Array4<const amrex::Real>, AMREX_SPACEDIM>
-        area_arr{{AMREX_D_DECL(
-          area[0].array(mfi), area[1].array(mfi), area[2].array(mfi))}};
-      for (int dir = 0; dir < AMREX_SPACEDIM; dir++) {
-        flux_ec[dir].resize(eboxes[dir], NVAR, amrex::The_Async_Arena());
-        flx[dir] = flux_ec[dir].array();
-        setV(eboxes[dir], NVAR, flx[dir], 0);
-      }
-
-      amrex::FArrayBox Dfab(cbox, NVAR, amrex::The_Async_Arena());
-      auto const& Dterm = Dfab.array();
-      setV(cbox, NVAR, Dterm, 0.0);
-
-      pc_compute_diffusion_flux(
-        cbox, qar, coe_cc, flx, area_arr, dx, do_harmonic, typ, Ncut,
-        d_sv_eb_bndry_geom, flags.array(mfi));
-
-      // Compute flux divergence (1/Vol).Div(F.A)
-      {
-        BL_PROFILE("PeleC::pc_flux_div()");
-        auto const& vol = volume.array(mfi);
-        amrex::ParallelFor(
-          cbox, NVAR,
-          [=] AMREX_GPU_DEVICE(int i, int j, int k, int n) noexcept {
-            pc_flux_div(
-              i, j, k, n, AMREX_D_DECL(flx[0], flx[1], flx[2]), vol, Dterm);
-          });
-      }
-
-      // Shut off unwanted diffusion after the fact.
-      //      Under normal conditions, you either have diffusion on all or
-      //      none, so this shouldn't be done this way.  However, the regression
-      //      test for diffusion works by diffusing only temperature through
-      //      this process.  Ideally, we'd redo that test to diffuse a passive
-      //      scalar instead....
-
-      if ((!diffuse_temp) && (!diffuse_enth)) {
-        setC(cbox, Eden, Eint, Dterm, 0.0);
-        for (int dir = 0; dir < AMREX_SPACEDIM; dir++) {
-          setC(eboxes[dir], Eden, Eint, flx[dir], 0.0);
-        }
-      }
-      if (!diffuse_spec) {
-        setC(cbox, FirstSpec, FirstSpec + NUM_SPECIES, Dterm, 0.0);
+              // Becase bcMask is read in the Riemann solver in any case,
+              // here we put physbc values in the appropriate faces for the
+           non-nscbc case set_bc_mask(lo, hi, domain_lo, domain_hi,
+                          AMREX_D_DECL(AMREX_TO_FORTRAN(bcMask[0]),
+                                 AMREX_TO_FORTRAN(bcMask[1]),
+                                 AMREX_TO_FORTRAN(bcMask[2])));
+
+              if (nscbc_diff == 1)
+              {
+                impose_NSCBC(lo, hi, domain_lo, domain_hi,
+                             AMREX_TO_FORTRAN(Sfab),
+                             AMREX_TO_FORTRAN(q.fab()),
+                             AMREX_TO_FORTRAN(qaux.fab()),
+                             AMREX_D_DECL(AMREX_TO_FORTRAN(bcMask[0]),
+                                    AMREX_TO_FORTRAN(bcMask[1]),
+                                    AMREX_TO_FORTRAN(bcMask[2])),
+                             &flag_nscbc_isAnyPerio, flag_nscbc_perio,
+                             &time, dx, &dt);
+              }
+        */
+        amrex::FArrayBox flux_ec[AMREX_SPACEDIM];
+        const amrex::Box eboxes[AMREX_SPACEDIM] = {AMREX_D_DECL(
+          amrex::surroundingNodes(cbox, 0), amrex::surroundingNodes(cbox, 1),
+          amrex::surroundingNodes(cbox, 2))};
+        amrex::GpuArray<amrex::Array4<amrex::Real>, AMREX_SPACEDIM> flx;
+        const amrex::GpuArray<
+          const amrex::Array4<const amrex::Real>, AMREX_SPACEDIM>
+          area_arr{{AMREX_D_DECL(
+            area[0].array(mfi), area[1].array(mfi), area[2].array(mfi))}};
         for (int dir = 0; dir < AMREX_SPACEDIM; dir++) {
-          setC(eboxes[dir], FirstSpec, FirstSpec + NUM_SPECIES, flx[dir], 0.0);
+          flux_ec[dir].resize(eboxes[dir], NVAR, amrex::The_Async_Arena());
+          flx[dir] = flux_ec[dir].array();
+          setV(eboxes[dir], NVAR, flx[dir], 0);
         }
-      }
 
-      if (!diffuse_vel) {
-        setC(cbox, Xmom, Xmom + 3, Dterm, 0.0);
-        for (int dir = 0; dir < AMREX_SPACEDIM; dir++) {
-          setC(eboxes[dir], Xmom, Xmom + 3, flx[dir], 0.0);
+        // The divergence is needed on cbox for the EB redistribution only
+        const amrex::Box& dbox = regular ? vbox : cbox;
+        amrex::FArrayBox Dfab;
+        if (!regular) {
+          Dfab.resize(cbox, NVAR, amrex::The_Async_Arena());
+          setV(cbox, NVAR, Dfab.array(), 0.0);
         }
-      }
+        auto const& Dterm = regular ? MOLSrc : Dfab.array();
 
-      // Set extensive flux at embedded boundary, potentially
-      // non-zero only for heat flux on isothermal boundaries,
-      // and momentum fluxes at no-slip walls
-      const auto nFlux = sv_eb_flux.empty() ? 0 : sv_eb_flux[local_i].numPts();
-      if (typ == amrex::FabType::singlevalued && Ncut > 0) {
-        eb_flux_thdlocal.setVal(0); // Default to Neumann for all fields
+        pc_compute_diffusion_flux(
+          cbox, qar, coe_cc, flx, area_arr, dx, do_harmonic, typ, Ncut,
+          d_sv_eb_bndry_geom, flags.array(mfi));
 
-        const auto Nvals = sv_eb_bcval[local_i].numPts();
+        // Compute flux divergence (1/Vol).Div(F.A). With MOL hydro this is
+        // done once the hyperbolic fluxes have been added.
+        const bool hydro_fluxes = do_hydro && do_mol;
+        if (!hydro_fluxes) {
+          BL_PROFILE("PeleC::pc_flux_div()");
+          auto const& vol = volume.array(mfi);
+          amrex::ParallelFor(
+            dbox, NVAR,
+            [=] AMREX_GPU_DEVICE(int i, int j, int k, int n) noexcept {
+              pc_flux_div(
+                i, j, k, n, AMREX_D_DECL(flx[0], flx[1], flx[2]), vol, Dterm);
+            });
+        }
 
-        AMREX_ASSERT(Nvals == Ncut);
-        AMREX_ASSERT(nFlux == Ncut);
+        // Shut off unwanted diffusion after the fact.
+        //      Under normal conditions, you either have diffusion on all or
+        //      none, so this shouldn't be done this way.  However, the
+        //      regression test for diffusion works by diffusing only
+        //      temperature through this process.  Ideally, we'd redo that
+        //      test to diffuse a passive scalar instead....
 
-        if (eb_isothermal && (diffuse_temp || diffuse_enth)) {
-          {
-            BL_PROFILE("PeleC::pc_apply_eb_boundry_flux_stencil()");
-            pc_apply_eb_boundry_flux_stencil(
-              ebfluxbox, sv_eb_bndry_grad_stencil[local_i].data(), Ncut, qar,
-              QTEMP, coe_cc, dComp_lambda, sv_eb_bcval[local_i].dataPtr(QTEMP),
-              Nvals, eb_flux_thdlocal.dataPtr(Eden), nFlux, 1);
+        if ((!diffuse_temp) && (!diffuse_enth)) {
+          if (!hydro_fluxes) {
+            setC(dbox, Eden, Eint, Dterm, 0.0);
+          }
+          for (int dir = 0; dir < AMREX_SPACEDIM; dir++) {
+            setC(eboxes[dir], Eden, Eint, flx[dir], 0.0);
           }
         }
-        // Compute momentum transfer at no-slip EB wall
-        if (eb_noslip && diffuse_vel) {
-          {
-            BL_PROFILE("PeleC::pc_apply_eb_boundry_visc_flux_stencil()");
-            pc_apply_eb_boundry_visc_flux_stencil(
-              ebfluxbox, sv_eb_bndry_grad_stencil[local_i].data(), Ncut,
-              d_sv_eb_bndry_geom, Ncut, qar, coe_cc,
-              sv_eb_bcval[local_i].dataPtr(QU), Nvals,
-              eb_flux_thdlocal.dataPtr(Xmom), nFlux);
+        if (!diffuse_spec) {
+          if (!hydro_fluxes) {
+            setC(dbox, FirstSpec, FirstSpec + NUM_SPECIES, Dterm, 0.0);
+          }
+          for (int dir = 0; dir < AMREX_SPACEDIM; dir++) {
+            setC(
+              eboxes[dir], FirstSpec, FirstSpec + NUM_SPECIES, flx[dir], 0.0);
           }
         }
-      }
 
-      // At this point flux_ec contains the diffusive fluxes in each direction
-      // at face centers for the (potentially partially covered) grid-aligned
-      // faces and eb_flux_thdlocal contains the flux for the cut faces. Before
-      // computing hybrid divergence, comptue and add in the hydro fluxes.
-      // Also, Dterm currently contains the divergence of the face-centered
-      // diffusion fluxes.  Increment this with the divergence of the
-      // face-centered hyperbloic fluxes.
-      if (do_hydro && do_mol) {
-        // amrex::FArrayBox flatn(cbox, 1, amrex::The_Async_Arena());
-        // flatn.setVal(1.0); // Set flattening to 1.0
-
-        // save off the diffusion source term and fluxes (don't want to filter
-        // these)
-        amrex::FArrayBox diffusion_flux[AMREX_SPACEDIM];
-        amrex::GpuArray<amrex::Array4<amrex::Real>, AMREX_SPACEDIM>
-          diffusion_flux_arr;
-        if (use_explicit_filter) {
+        if (!diffuse_vel) {
+          if (!hydro_fluxes) {
+            setC(dbox, Xmom, Xmom + 3, Dterm, 0.0);
+          }
           for (int dir = 0; dir < AMREX_SPACEDIM; dir++) {
-            diffusion_flux[dir].resize(
-              flux_ec[dir].box(), NVAR, amrex::The_Async_Arena());
-            diffusion_flux_arr[dir] = diffusion_flux[dir].array();
-            copy_array4(
-              flux_ec[dir].box(), flux_ec[dir].nComp(), flx[dir],
-              diffusion_flux_arr[dir]);
+            setC(eboxes[dir], Xmom, Xmom + 3, flx[dir], 0.0);
           }
         }
 
-        { // Get face-centered hyperbolic fluxes and their divergences.
-          // Get hyp flux at EB wall
-          BL_PROFILE("PeleC::pc_hyp_mol_flux()");
-          amrex::Real* d_eb_flux_thdlocal =
-            (nFlux > 0 ? eb_flux_thdlocal.dataPtr() : nullptr);
-          pc_compute_hyp_mol_flux(
-            cbox, qar, qauxar, flx, area_arr, dx, plm_iorder, use_laxf_flux,
-            flags.array(mfi), d_sv_eb_bndry_geom, Ncut, d_eb_flux_thdlocal,
-            nFlux);
+        // Set extensive flux at embedded boundary, potentially
+        // non-zero only for heat flux on isothermal boundaries,
+        // and momentum fluxes at no-slip walls
+        const auto nFlux =
+          (sv_eb_flux.empty() || regular) ? 0 : sv_eb_flux[local_i].numPts();
+        if (typ == amrex::FabType::singlevalued && Ncut > 0) {
+          eb_flux_thdlocal.setVal(0); // Default to Neumann for all fields
+
+          const auto Nvals = sv_eb_bcval[local_i].numPts();
+
+          AMREX_ASSERT(Nvals == Ncut);
+          AMREX_ASSERT(nFlux == Ncut);
+
+          if (eb_isothermal && (diffuse_temp || diffuse_enth)) {
+            {
+              BL_PROFILE("PeleC::pc_apply_eb_boundry_flux_stencil()");
+              pc_apply_eb_boundry_flux_stencil(
+                ebfluxbox, sv_eb_bndry_grad_stencil[local_i].data(), Ncut,
+                qar, QTEMP, coe_cc, dComp_lambda,
+                sv_eb_bcval[local_i].dataPtr(QTEMP), Nvals,
+                eb_flux_thdlocal.dataPtr(Eden), nFlux, 1);
+            }
+          }
+          // Compute momentum transfer at no-slip EB wall
+          if (eb_noslip && diffuse_vel) {
+            {
+              BL_PROFILE("PeleC::pc_apply_eb_boundry_visc_flux_stencil()");
+              pc_apply_eb_boundry_visc_flux_stencil(
+                ebfluxbox, sv_eb_bndry_grad_stencil[local_i].data(), Ncut,
+                d_sv_eb_bndry_geom, Ncut, qar, coe_cc,
+                sv_eb_bcval[local_i].dataPtr(QU), Nvals,
+                eb_flux_thdlocal.dataPtr(Xmom), nFlux);
+            }
+          }
         }
 
-        // Filter hydro source term and fluxes here
-        if (use_explicit_filter) {
-          // Get the hydro term
-          amrex::FArrayBox hydro_flux[AMREX_SPACEDIM];
+        // At this point flux_ec contains the diffusive fluxes in each
+        // direction at face centers for the (potentially partially covered)
+        // grid-aligned faces and eb_flux_thdlocal contains the flux for the
+        // cut faces. Before computing hybrid divergence, comptue and add in
+        // the hydro fluxes. The divergence of the combined face-centered
+        // fluxes is then taken in a single pass.
+        if (hydro_fluxes) {
+          // amrex::FArrayBox flatn(cbox, 1, amrex::The_Async_Arena());
+          // flatn.setVal(1.0); // Set flattening to 1.0
+
+          // save off the diffusion source term and fluxes (don't want to filter
+          // these)
+          amrex::FArrayBox diffusion_flux[AMREX_SPACEDIM];
           amrex::GpuArray<amrex::Array4<amrex::Real>, AMREX_SPACEDIM>
-            hydro_flux_arr;
-          for (int dir = 0; dir < AMREX_SPACEDIM; dir++) {
-            hydro_flux[dir].resize(
-              flux_ec[dir].box(), NVAR, amrex::The_Async_Arena());
-            hydro_flux_arr[dir] = hydro_flux[dir].array();
-            lincomb_array4(
-              flux_ec[dir].box(), Density, NVAR, flx[dir],
-              diffusion_flux_arr[dir], 1.0, -1.0, hydro_flux_arr[dir]);
+            diffusion_flux_arr;
+          if (use_explicit_filter) {
+            for (int dir = 0; dir < AMREX_SPACEDIM; dir++) {
+              diffusion_flux[dir].resize(
+                flux_ec[dir].box(), NVAR, amrex::The_Async_Arena());
+              diffusion_flux_arr[dir] = diffusion_flux[dir].array();
+              copy_array4(
+                flux_ec[dir].box(), flux_ec[dir].nComp(), flx[dir],
+                diffusion_flux_arr[dir]);
+            }
           }
 
-          // Filter
-          const amrex::Box fbox = amrex::grow(cbox, -nGrowF);
-          for (int dir = 0; dir < AMREX_SPACEDIM; dir++) {
-            const amrex::Box& bxtmp = amrex::surroundingNodes(fbox, dir);
-            amrex::FArrayBox filtered_hydro_flux(
-              bxtmp, NVAR, amrex::The_Async_Arena());
-            les_filter.apply_filter(
-              bxtmp, hydro_flux[dir], filtered_hydro_flux, Density, NVAR);
-
-            setV(bxtmp, hydro_flux[dir].nComp(), hydro_flux_arr[dir], 0.0);
-            copy_array4(
-              bxtmp, hydro_flux[dir].nComp(), filtered_hydro_flux.array(),
-              hydro_flux_arr[dir]);
+          { // Get face-centered hyperbolic fluxes and their divergences.
+            // Get hyp flux at EB wall
+            BL_PROFILE("PeleC::pc_hyp_mol_flux()");
+            amrex::Real* d_eb_flux_thdlocal =
+              (nFlux > 0 ? eb_flux_thdlocal.dataPtr() : nullptr);
+            pc_compute_hyp_mol_flux(
+              cbox, qar, qauxar, flx, area_arr, dx, plm_iorder, use_laxf_flux,
+              gamma_cache_tol, flags.array(mfi), d_sv_eb_bndry_geom, Ncut,
+              d_eb_flux_thdlocal, nFlux);
           }
 
-          // Combine with diffusion
-          for (int dir = 0; dir < AMREX_SPACEDIM; dir++) {
-            lincomb_array4(
-              diffusion_flux[dir].box(), Density, NVAR, diffusion_flux_arr[dir],
-              hydro_flux_arr[dir], 1.0, 1.0, flx[dir]);
-          }
-        }
+          // Filter hydro source term and fluxes here
+          if (use_explicit_filter) {
+            // Get the hydro term
+            amrex::FArrayBox hydro_flux[AMREX_SPACEDIM];
+            amrex::GpuArray<amrex::Array4<amrex::Real>, AMREX_SPACEDIM>
+              hydro_flux_arr;
+            for (int dir = 0; dir < AMREX_SPACEDIM; dir++) {
+              hydro_flux[dir].resize(
+                flux_ec[dir].box(), NVAR, amrex::The_Async_Arena());
+              hydro_flux_arr[dir] = hydro_flux[dir].array();
+              lincomb_array4(
+                flux_ec[dir].box(), Density, NVAR, flx[dir],
+                diffusion_flux_arr[dir], 1.0, -1.0, hydro_flux_arr[dir]);
+            }
 
-        // Compute flux divergence (1/Vol).Div(F.A)
-        {
-          BL_PROFILE("PeleC::pc_flux_div()");
-          auto const& vol = volume.array(mfi);
-          amrex::ParallelFor(
-            cbox, NVAR,
-            [=] AMREX_GPU_DEVICE(int i, int j, int k, int n) noexcept {
-              pc_flux_div(
-                i, j, k, n, AMREX_D_DECL(flx[0], flx[1], flx[2]), vol, Dterm);
-            });
-        }
-      }
+            // Filter
+            const amrex::Box fbox = amrex::grow(cbox, -nGrowF);
+            for (int dir = 0; dir < AMREX_SPACEDIM; dir++) {
+              const amrex::Box& bxtmp = amrex::surroundingNodes(fbox, dir);
+              amrex::FArrayBox filtered_hydro_flux(
+                bxtmp, NVAR, amrex::The_Async_Arena());
+              les_filter.apply_filter(
+                bxtmp, hydro_flux[dir], filtered_hydro_flux, Density, NVAR);
+
+              setV(bxtmp, hydro_flux[dir].nComp(), hydro_flux_arr[dir], 0.0);
+              copy_array4(
+                bxtmp, hydro_flux[dir].nComp(), filtered_hydro_flux.array(),
+                hydro_flux_arr[dir]);
+            }
 
-      if (eb_in_domain) {
-        amrex::Gpu::DeviceVector<int> v_eb_tile_mask(Ncut, 0);
-        int* eb_tile_mask = v_eb_tile_mask.dataPtr();
-        amrex::ParallelFor(Ncut, [=] AMREX_GPU_DEVICE(int icut) {
-          if (ebfluxbox.contains(d_sv_eb_bndry_geom[icut].iv)) {
-            eb_tile_mask[icut] = 1;
+            // Combine with diffusion
+            for (int dir = 0; dir < AMREX_SPACEDIM; dir++) {
+              lincomb_array4(
+                diffusion_flux[dir].box(), Density, NVAR,
+                diffusion_flux_arr[dir], hydro_flux_arr[dir], 1.0, 1.0,
+                flx[dir]);
+            }
           }
-        });
-        if (typ == amrex::FabType::singlevalued && Ncut > 0) {
-          sv_eb_flux[local_i].merge(eb_flux_thdlocal, 0, NVAR, v_eb_tile_mask);
-        }
 
-        amrex::FArrayBox dm_as_fine;
-        amrex::FArrayBox fab_drho_as_crse;
-        amrex::IArrayBox fab_rrflag_as_crse;
-        if (typ == amrex::FabType::singlevalued) {
-          // Interpolate fluxes from face centers to face centroids
-          // Note that hybrid divergence and redistribution algorithms require
-          // that we be able to compute the conservative divergence on 2 grow
-          // cells, so we need interpolated fluxes on 2 grow cells, and
-          // therefore we need face centered fluxes on 3.
+          // Compute flux divergence (1/Vol).Div(F.A)
           {
-            BL_PROFILE("PeleC::pc_apply_face_stencil()");
-            for (int dir = 0; dir < AMREX_SPACEDIM; ++dir) {
-              const auto Nsten =
-                static_cast<int>(flux_interp_stencil[dir][local_i].size());
-              const amrex::Box valid_interped_flux_box =
-                amrex::Box(ebfluxbox).surroundingNodes(dir);
-              if (Nsten > 0) {
-                pc_apply_face_stencil(
-                  valid_interped_flux_box, stencil_volume_box,
-                  flux_interp_stencil[dir][local_i].data(), Nsten, dir, NVAR,
-                  flx[dir]);
-              }
-            }
-            amrex::Gpu::Device::streamSynchronize();
+            BL_PROFILE("PeleC::pc_flux_div()");
+            auto const& vol = volume.array(mfi);
+            amrex::ParallelFor(
+              dbox, NVAR,
+              [=] AMREX_GPU_DEVICE(int i, int j, int k, int n) noexcept {
+                pc_flux_div(
+                  i, j, k, n, AMREX_D_DECL(flx[0], flx[1], flx[2]), vol, Dterm);
+              });
           }
+        }
 
-          // Get "hybrid flux divergence" and redistribute
-          //
-          // This operation takes as input centroid-centered fluxes and a
-          // corresponding
-          //  divergence on three grid cells.  Actually, we assume that
-          //  div=(1/VOL)Div(flux) (VOL = volume of the full cells), and that
-          //  flux is EXTENSIVE, weighted with the full face areas.
-          //
-          // Upon return:
-          // div = kappa.(1/Vol) Div(FluxC.Area)  Vol = kappa.VOL,
-          // Area=aperture.AREA, defined over the valid box
-
-          // TODO: Rework this for r-z, if applicable
-          amrex::Real vol = 1;
-          for (int dir = 0; dir < AMREX_SPACEDIM; ++dir) {
-            vol *= geom.CellSize()[dir];
+        if (eb_in_domain && !regular) {
+          amrex::Gpu::DeviceVector<int> v_eb_tile_mask(Ncut, 0);
+          int* eb_tile_mask = v_eb_tile_mask.dataPtr();
+          amrex::ParallelFor(Ncut, [=] AMREX_GPU_DEVICE(int icut) {
+            if (ebfluxbox.contains(d_sv_eb_bndry_geom[icut].iv)) {
+              eb_tile_mask[icut] = 1;
+            }
+          });
+          if (typ == amrex::FabType::singlevalued && Ncut > 0) {
+            sv_eb_flux[local_i].merge(
+              eb_flux_thdlocal, 0, NVAR, v_eb_tile_mask);
           }
 
-          dm_as_fine.resize(
-            amrex::Box::TheUnitBox(), NVAR, amrex::The_Async_Arena());
-          fab_drho_as_crse.resize(
-            amrex::Box::TheUnitBox(), NVAR, amrex::The_Async_Arena());
-          fab_rrflag_as_crse.resize(
-            amrex::Box::TheUnitBox(), 1, amrex::The_Async_Arena());
-          {
-            if (fr_as_fine != nullptr) {
-              dm_as_fine.resize(
-                amrex::grow(vbox, 1), NVAR, amrex::The_Async_Arena());
-              dm_as_fine.setVal<amrex::RunOn::Device>(0.0);
-            }
-            if (Ncut > 0) {
-              BL_PROFILE("PeleC::pc_eb_div()");
-              pc_eb_div(
-                vbox, vol, NVAR, d_sv_eb_bndry_geom, Ncut,
-                AMREX_D_DECL(flx[0], flx[1], flx[2]),
-                sv_eb_flux[local_i].dataPtr(), vfrac.array(mfi), Dterm);
+          amrex::FArrayBox dm_as_fine;
+          amrex::FArrayBox fab_drho_as_crse;
+          amrex::IArrayBox fab_rrflag_as_crse;
+          if (typ == amrex::FabType::singlevalued) {
+            // Interpolate fluxes from face centers to face centroids
+            // Note that hybrid divergence and redistribution algorithms require
+            // that we be able to compute the conservative divergence on 2 grow
+            // cells, so we need interpolated fluxes on 2 grow cells, and
+            // therefore we need face centered fluxes on 3.
+            {
+              BL_PROFILE("PeleC::pc_apply_face_stencil()");
+              for (int dir = 0; dir < AMREX_SPACEDIM; ++dir) {
+                const auto Nsten =
+                  static_cast<int>(flux_interp_stencil[dir][local_i].size());
+                const amrex::Box valid_interped_flux_box =
+                  amrex::Box(ebfluxbox).surroundingNodes(dir);
+                if (Nsten > 0) {
+                  pc_apply_face_stencil(
+                    valid_interped_flux_box, stencil_volume_box,
+                    flux_interp_stencil[dir][local_i].data(), Nsten, dir, NVAR,
+                    flx[dir]);
+                }
+              }
+              amrex::Gpu::Device::streamSynchronize();
             }
-          }
 
-          if (do_reflux && flux_factor != 0) {
-            for (auto& dir : flux_ec) {
-              dir.mult<amrex::RunOn::Device>(flux_factor, dir.box());
+            // Get "hybrid flux divergence" and redistribute
+            //
+            // This operation takes as input centroid-centered fluxes and a
+            // corresponding
+            //  divergence on three grid cells.  Actually, we assume that
+            //  div=(1/VOL)Div(flux) (VOL = volume of the full cells), and that
+            //  flux is EXTENSIVE, weighted with the full face areas.
+            //
+            // Upon return:
+            // div = kappa.(1/Vol) Div(FluxC.Area)  Vol = kappa.VOL,
+            // Area=aperture.AREA, defined over the valid box
+
+            // TODO: Rework this for r-z, if applicable
+            amrex::Real vol = 1;
+            for (int dir = 0; dir < AMREX_SPACEDIM; ++dir) {
+              vol *= geom.CellSize()[dir];
             }
 
-            if (fr_as_crse != nullptr) {
-              fr_as_crse->CrseAdd(
-                mfi, {AMREX_D_DECL(&flux_ec[0], &flux_ec[1], &flux_ec[2])},
-                dxD.data(), dt, vfrac[mfi],
-                {AMREX_D_DECL(
-                  &((*areafrac[0])[mfi]), &((*areafrac[1])[mfi]),
-                  &((*areafrac[2])[mfi]))},
-                amrex::RunOn::Device);
+            dm_as_fine.resize(
+              amrex::Box::TheUnitBox(), NVAR, amrex::The_Async_Arena());
+            fab_drho_as_crse.resize(
+              amrex::Box::TheUnitBox(), NVAR, amrex::The_Async_Arena());
+            fab_rrflag_as_crse.resize(
+              amrex::Box::TheUnitBox(), 1, amrex::The_Async_Arena());
+            {
+              if (fr_as_fine != nullptr) {
+                dm_as_fine.resize(
+                  amrex::grow(vbox, 1), NVAR, amrex::The_Async_Arena());
+                dm_as_fine.setVal<amrex::RunOn::Device>(0.0);
+              }
+              if (Ncut > 0) {
+                BL_PROFILE("PeleC::pc_eb_div()");
+                pc_eb_div(
+                  vbox, vol, NVAR, d_sv_eb_bndry_geom, Ncut,
+                  AMREX_D_DECL(flx[0], flx[1], flx[2]),
+                  sv_eb_flux[local_i].dataPtr(), vfrac.array(mfi), Dterm);
+              }
             }
 
-            if (fr_as_fine != nullptr) {
-              fr_as_fine->FineAdd(
-                mfi, {AMREX_D_DECL(&flux_ec[0], &flux_ec[1], &flux_ec[2])},
-                dxD.data(), dt, vfrac[mfi],
-                {AMREX_D_DECL(
-                  &((*areafrac[0])[mfi]), &((*areafrac[1])[mfi]),
-                  &((*areafrac[2])[mfi]))},
-                dm_as_fine, amrex::RunOn::Device);
+            if (do_reflux && flux_factor != 0) {
+              for (auto& dir : flux_ec) {
+                dir.mult<amrex::RunOn::Device>(flux_factor, dir.box());
+              }
+
+              if (fr_as_crse != nullptr) {
+                fr_as_crse->CrseAdd(
+                  mfi, {AMREX_D_DECL(&flux_ec[0], &flux_ec[1], &flux_ec[2])},
+                  dxD.data(), dt, vfrac[mfi],
+                  {AMREX_D_DECL(
+                    &((*areafrac[0])[mfi]), &((*areafrac[1])[mfi]),
+                    &((*areafrac[2])[mfi]))},
+                  amrex::RunOn::Device);
+              }
+
+              if (fr_as_fine != nullptr) {
+                fr_as_fine->FineAdd(
+                  mfi, {AMREX_D_DECL(&flux_ec[0], &flux_ec[1], &flux_ec[2])},
+                  dxD.data(), dt, vfrac[mfi],
+                  {AMREX_D_DECL(
+                    &((*areafrac[0])[mfi]), &((*areafrac[1])[mfi]),
+                    &((*areafrac[2])[mfi]))},
+                  dm_as_fine, amrex::RunOn::Device);
+              }
             }
+          } else if (typ != amrex::FabType::regular) { // Single valued if loop
+            amrex::Abort("multi-valued eb boundary fluxes to be implemented");
           }
-        } else if (typ != amrex::FabType::regular) { // Single valued if loop
-          amrex::Abort("multi-valued eb boundary fluxes to be implemented");
         }
-      }
 
-      if (do_reflux && flux_factor != 0 && typ == amrex::FabType::regular) {
-        for (int dir = 0; dir < AMREX_SPACEDIM; dir++) {
-          amrex::ParallelFor(
-            eboxes[dir], NVAR,
-            [=] AMREX_GPU_DEVICE(int i, int j, int k, int n) noexcept {
-              flx[dir](i, j, k, n) *= flux_factor;
-            });
-        }
+        if (do_reflux && flux_factor != 0 && regular) {
+          for (int dir = 0; dir < AMREX_SPACEDIM; dir++) {
+            amrex::ParallelFor(
+              eboxes[dir], NVAR,
+              [=] AMREX_GPU_DEVICE(int i, int j, int k, int n) noexcept {
+                flx[dir](i, j, k, n) *= flux_factor;
+              });
+          }
 
-        if ((level < parent->finestLevel()) && (fr_as_crse != nullptr)) {
-          fr_as_crse->CrseAdd(
-            mfi, {{AMREX_D_DECL(&flux_ec[0], &flux_ec[1], &flux_ec[2])}},
-            dxD.data(), dt, amrex::RunOn::Device);
+          if ((level < parent->finestLevel()) && (fr_as_crse != nullptr)) {
+            fr_as_crse->CrseAdd(
+              mfi, {{AMREX_D_DECL(&flux_ec[0], &flux_ec[1], &flux_ec[2])}},
+              dxD.data(), dt, amrex::RunOn::Device);
+          }
+
+          if ((level > 0) && (fr_as_fine != nullptr)) {
+            fr_as_fine->FineAdd(
+              mfi, {{AMREX_D_DECL(&flux_ec[0], &flux_ec[1], &flux_ec[2])}},
+              dxD.data(), dt, amrex::RunOn::Device);
+          }
         }
 
-        if ((level > 0) && (fr_as_fine != nullptr)) {
-          fr_as_fine->FineAdd(
-            mfi, {{AMREX_D_DECL(&flux_ec[0], &flux_ec[1], &flux_ec[2])}},
-            dxD.data(), dt, amrex::RunOn::Device);
+        // Extrapolate to GhostCells
+        if ((MOLSrcTerm.nGrow() > 0) && !regular) {
+          BL_PROFILE("PeleC::diffextrap()");
+          const int mg = MOLSrcTerm.nGrow();
+          const auto* low = vbox.loVect();
+          const auto* high = vbox.hiVect();
+          auto dlo = Dterm.begin;
+          auto dhi = Dterm.end;
+          const int AMREX_D_DECL(lx = low[0], ly = low[1], lz = low[2]);
+          const int AMREX_D_DECL(hx = high[0], hy = high[1], hz = high[2]);
+          amrex::ParallelFor(
+            vbox, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
+              pc_diffextrap(
+                i, j, k, Dterm, mg, UMX, UMZ + 1, AMREX_D_DECL(lx, ly, lz),
+                AMREX_D_DECL(hx, hy, hz), dlo, dhi);
+              pc_diffextrap(
+                i, j, k, Dterm, mg, UFS, UFS + NUM_SPECIES,
+                AMREX_D_DECL(lx, ly, lz), AMREX_D_DECL(hx, hy, hz), dlo, dhi);
+              pc_diffextrap(
+                i, j, k, Dterm, mg, UEDEN, UEDEN + 1, AMREX_D_DECL(lx, ly, lz),
+                AMREX_D_DECL(hx, hy, hz), dlo, dhi);
+            });
         }
-      }
 
-      // Extrapolate to GhostCells
-      if (MOLSrcTerm.nGrow() > 0) {
-        BL_PROFILE("PeleC::diffextrap()");
-        const int mg = MOLSrcTerm.nGrow();
-        const auto* low = vbox.loVect();
-        const auto* high = vbox.hiVect();
-        auto dlo = Dterm.begin;
-        auto dhi = Dterm.end;
-        const int AMREX_D_DECL(lx = low[0], ly = low[1], lz = low[2]);
-        const int AMREX_D_DECL(hx = high[0], hy = high[1], hz = high[2]);
-        amrex::ParallelFor(
-          vbox, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
-            pc_diffextrap(
-              i, j, k, Dterm, mg, UMX, UMZ + 1, AMREX_D_DECL(lx, ly, lz),
-              AMREX_D_DECL(hx, hy, hz), dlo, dhi);
-            pc_diffextrap(
-              i, j, k, Dterm, mg, UFS, UFS + NUM_SPECIES,
-              AMREX_D_DECL(lx, ly, lz), AMREX_D_DECL(hx, hy, hz), dlo, dhi);
-            pc_diffextrap(
-              i, j, k, Dterm, mg, UEDEN, UEDEN + 1, AMREX_D_DECL(lx, ly, lz),
-              AMREX_D_DECL(hx, hy, hz), dlo, dhi);
-          });
-      }
+        // EB redistribution
+        if (eb_in_domain && !regular) {
+          AMREX_D_TERM(auto apx = areafrac[0]->const_array(mfi);
+                       , auto apy = areafrac[1]->const_array(mfi);
+                       , auto apz = areafrac[2]->const_array(mfi););
+          AMREX_D_TERM(auto fcx = facecent[0]->const_array(mfi);
+                       , auto fcy = facecent[1]->const_array(mfi);
+                       , auto fcz = facecent[2]->const_array(mfi););
+          auto ccc = fact.getCentroid().const_array(mfi);
+
+          amrex::FArrayBox tmpfab(
+            Dfab.box(), S.nComp(), amrex::The_Async_Arena());
+          if (redistribution_type == "FluxRedist") {
+            tmpfab.setVal<amrex::RunOn::Device>(1.0, tmpfab.box());
+          }
+          amrex::Array4<amrex::Real> scratch = tmpfab.array();
 
-      // EB redistribution
-      if (eb_in_domain && (typ != amrex::FabType::regular)) {
-        AMREX_D_TERM(auto apx = areafrac[0]->const_array(mfi);
-                     , auto apy = areafrac[1]->const_array(mfi);
-                     , auto apz = areafrac[2]->const_array(mfi););
-        AMREX_D_TERM(auto fcx = facecent[0]->const_array(mfi);
-                     , auto fcy = facecent[1]->const_array(mfi);
-                     , auto fcz = facecent[2]->const_array(mfi););
-        auto ccc = fact.getCentroid().const_array(mfi);
-
-        amrex::FArrayBox tmpfab(
-          Dfab.box(), S.nComp(), amrex::The_Async_Arena());
-        if (redistribution_type == "FluxRedist") {
-          tmpfab.setVal<amrex::RunOn::Device>(1.0, tmpfab.box());
-        }
-        amrex::Array4<amrex::Real> scratch = tmpfab.array();
-
-        amrex::FArrayBox Dterm_tmpfab(
-          Dfab.box(), S.nComp(), amrex::The_Async_Arena());
-        amrex::Array4<amrex::Real> Dterm_tmp = Dterm_tmpfab.array();
-        copy_array4(Dfab.box(), NVAR, Dterm, Dterm_tmp);
-
-        auto flag_arr = flags.const_array(mfi);
-        {
-          BL_PROFILE("Redistribution::Apply()");
-          Redistribution::Apply(
-            vbox, S.nComp(), Dterm, Dterm_tmp, S.const_array(mfi), scratch,
-            flag_arr, AMREX_D_DECL(apx, apy, apz), vfrac.const_array(mfi),
-            AMREX_D_DECL(fcx, fcy, fcz), ccc, d_bcs.dataPtr(), geom, dt,
-            redistribution_type, eb_srd_max_order);
-        }
+          amrex::FArrayBox Dterm_tmpfab(
+            Dfab.box(), S.nComp(), amrex::The_Async_Arena());
+          amrex::Array4<amrex::Real> Dterm_tmp = Dterm_tmpfab.array();
+          copy_array4(Dfab.box(), NVAR, Dterm, Dterm_tmp);
 
-        // Make sure div is zero in covered cells
-        amrex::ParallelFor(
-          vbox, S.nComp(),
-          [=] AMREX_GPU_DEVICE(int i, int j, int k, int n) noexcept {
-            if (flag_arr(i, j, k).isCovered()) {
-              Dterm(i, j, k, n) = 0.0;
-            }
-          });
+          auto flag_arr = flags.const_array(mfi);
+          {
+            BL_PROFILE("Redistribution::Apply()");
+            Redistribution::Apply(
+              vbox, S.nComp(), Dterm, Dterm_tmp, S.const_array(mfi), scratch,
+              flag_arr, AMREX_D_DECL(apx, apy, apz), vfrac.const_array(mfi),
+              AMREX_D_DECL(fcx, fcy, fcz), ccc, d_bcs.dataPtr(), geom, dt,
+              redistribution_type, eb_srd_max_order);
+          }
 
-        // Make sure rho div is same as sum rhoY div
-        amrex::ParallelFor(
-          vbox, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
-            Dterm(i, j, k, URHO) = 0.0;
-            for (int n = 0; n < NUM_SPECIES; n++) {
-              Dterm(i, j, k, URHO) += Dterm(i, j, k, UFS + n);
-            }
-          });
+          // Make sure div is zero in covered cells
+          amrex::ParallelFor(
+            vbox, S.nComp(),
+            [=] AMREX_GPU_DEVICE(int i, int j, int k, int n) noexcept {
+              if (flag_arr(i, j, k).isCovered()) {
+                Dterm(i, j, k, n) = 0.0;
+              }
+            });
+
+          // Make sure rho div is same as sum rhoY div
+          amrex::ParallelFor(
+            vbox, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
+              Dterm(i, j, k, URHO) = 0.0;
+              for (int n = 0; n < NUM_SPECIES; n++) {
+                Dterm(i, j, k, URHO) += Dterm(i, j, k, UFS + n);
+              }
+            });
 
-        // Make sure the massfractions are ok in cut cells
-        if ((eb_clean_massfrac) && (typ != amrex::FabType::covered)) {
-          pc_eb_clean_massfrac(
-            vbox, dt, eb_clean_massfrac_threshold, S.const_array(mfi), flag_arr,
-            scratch, Dterm);
+          // Make sure the massfractions are ok in cut cells
+          if ((eb_clean_massfrac) && (typ != amrex::FabType::covered)) {
+            pc_eb_clean_massfrac(
+              vbox, dt, eb_clean_massfrac_threshold, S.const_array(mfi),
+              flag_arr, scratch, Dterm);
+          }
         }
-      }
 
-      copy_array4(vbox, NVAR, Dterm, MOLSrc);
+        if (!regular) {
+          copy_array4(vbox, NVAR, Dterm, MOLSrc);
+        }
 
-      if (do_mol_load_balance && (cost != nullptr)) {
-        amrex::Gpu::streamSynchronize();
-        wt = (amrex::ParallelDescriptor::second() - wt) / vbox.d_numPts();
-        (*cost)[mfi].plus<amrex::RunOn::Device>(wt, vbox);
+        if (do_mol_load_balance && (cost != nullptr)) {
+          amrex::Gpu::streamSynchronize();
+          wt = (amrex::ParallelDescriptor::second() - wt) / vbox.d_numPts();
+          (*cost)[mfi].plus<amrex::RunOn::Device>(wt, vbox);
+        }
       }
     }
   }
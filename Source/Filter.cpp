@@ -420,24 +420,16 @@ Filter::apply_filter(
   // Ensure enough grow cells
   AMREX_ASSERT(in.nGrow() >= out.nGrow() + _ngrow);
 
-  const auto& ins = in.const_arrays();
-  const auto& outs = out.arrays();
   out.setVal(0, nstart, ncnt);
 
-  amrex::Gpu::DeviceVector<amrex::Real> weights(_weights.size());
-  amrex::Real* w = weights.data();
-  amrex::Gpu::copy(
-    amrex::Gpu::hostToDevice, _weights.begin(), _weights.end(),
-    weights.begin());
-  const int captured_ngrow = _ngrow;
-
-  const amrex::IntVect ngs(out.nGrow());
-  amrex::ParallelFor(
-    in, ngs, ncnt - nstart,
-    [=] AMREX_GPU_DEVICE(int nbx, int i, int j, int k, int nc) noexcept {
-      run_filter(i, j, k, nc, captured_ngrow, nstart, w, ins[nbx], outs[nbx]);
-    });
-  amrex::Gpu::synchronize();
+#ifdef AMREX_USE_OMP
+#pragma omp parallel if (amrex::Gpu::notInLaunchRegion())
+#endif
+  for (amrex::MFIter mfi(out, amrex::TilingIfNotGPU()); mfi.isValid();
+       ++mfi) {
+    const amrex::Box& bx = mfi.growntilebox();
+    apply_filter(bx, in[mfi], out[mfi], nstart, ncnt, in.nComp());
+  }
 }
 
 // Run the filtering operation on a FAB
@@ -472,19 +464,41 @@ Filter::apply_filter(
   const int ncnt,
   const int /*ncomp*/)
 {
-  const auto q = in.const_array();
-  auto qh = out.array();
-  setC(box, nstart, ncnt, qh, 0.0);
-  amrex::Gpu::DeviceVector<amrex::Real> weights(_weights.size());
-  amrex::Real* w = weights.data();
-  amrex::Gpu::copy(
-    amrex::Gpu::hostToDevice, _weights.begin(), _weights.end(),
-    weights.begin());
-
-  const int captured_ngrow = _ngrow;
-  amrex::ParallelFor(
-    box, ncnt - nstart,
-    [=] AMREX_GPU_DEVICE(int i, int j, int k, int nc) noexcept {
-      run_filter(i, j, k, nc, captured_ngrow, nstart, w, q, qh);
-    });
+  const int nc = ncnt - nstart;
+  const int ng = _ngrow;
+  const amrex::Real* w = _d_weights.data();
+
+  // One pass per direction, (2 ng + 1) * AMREX_SPACEDIM operations per cell
+  // instead of (2 ng + 1)^AMREX_SPACEDIM. Each pass is done on the box grown
+  // in the directions that remain to be filtered, and the intermediate
+  // results go back and forth between two tile-sized buffers.
+  amrex::FArrayBox tmp[2];
+  amrex::Array4<const amrex::Real> src = in.const_array();
+  int src_comp = nstart;
+  for (int dir = 0; dir < AMREX_SPACEDIM; dir++) {
+    amrex::Box pbx(box);
+    for (int d = dir + 1; d < AMREX_SPACEDIM; d++) {
+      pbx.grow(d, ng);
+    }
+
+    amrex::Array4<amrex::Real> dst;
+    int dst_comp = 0;
+    if (dir == AMREX_SPACEDIM - 1) {
+      dst = out.array();
+      dst_comp = nstart;
+    } else {
+      tmp[dir % 2].resize(pbx, nc, amrex::The_Async_Arena());
+      dst = tmp[dir % 2].array();
+    }
+
+    amrex::ParallelFor(
+      pbx, nc, [=] AMREX_GPU_DEVICE(int i, int j, int k, int n) noexcept {
+        run_filter_1d(
+          amrex::IntVect(AMREX_D_DECL(i, j, k)), n, dir, ng, w, src, src_comp,
+          dst, dst_comp);
+      });
+
+    src = dst;
+    src_comp = dst_comp;
+  }
 }
@@ -32,7 +32,9 @@ pc_umeth_3D(
   const int ppm_type,
   const bool use_flattening,
   const bool use_hybrid_weno,
-  const int weno_scheme)
+  const int weno_scheme,
+  const amrex::Real gamma_cache_tol,
+  CTUWorkspace& ws)
 {
   amrex::Real const dx = del[0];
   amrex::Real const dy = del[1];
@@ -65,28 +67,28 @@ pc_umeth_3D(
   int cdir = 0;
   const amrex::Box& xmbx = growHi(bxg2, cdir, 1);
   const amrex::Box& xflxbx = surroundingNodes(grow(bxg2, cdir, -1), cdir);
-  amrex::FArrayBox qxm(xmbx, QVAR, amrex::The_Async_Arena());
-  amrex::FArrayBox qxp(bxg2, QVAR, amrex::The_Async_Arena());
-  auto const& qxmarr = qxm.array();
-  auto const& qxparr = qxp.array();
+  ws.qm[cdir].resize(xmbx, QVAR, amrex::The_Async_Arena());
+  ws.qp[cdir].resize(bxg2, QVAR, amrex::The_Async_Arena());
+  auto const& qxmarr = ws.qm[cdir].array();
+  auto const& qxparr = ws.qp[cdir].array();
 
   // Y data
   cdir = 1;
   const amrex::Box& ymbx = growHi(bxg2, cdir, 1);
   const amrex::Box& yflxbx = surroundingNodes(grow(bxg2, cdir, -1), cdir);
-  amrex::FArrayBox qym(ymbx, QVAR, amrex::The_Async_Arena());
-  amrex::FArrayBox qyp(bxg2, QVAR, amrex::The_Async_Arena());
-  auto const& qymarr = qym.array();
-  auto const& qyparr = qyp.array();
+  ws.qm[cdir].resize(ymbx, QVAR, amrex::The_Async_Arena());
+  ws.qp[cdir].resize(bxg2, QVAR, amrex::The_Async_Arena());
+  auto const& qymarr = ws.qm[cdir].array();
+  auto const& qyparr = ws.qp[cdir].array();
 
   // Z data
   cdir = 2;
   const amrex::Box& zmbx = growHi(bxg2, cdir, 1);
   const amrex::Box& zflxbx = surroundingNodes(grow(bxg2, cdir, -1), cdir);
-  amrex::FArrayBox qzm(zmbx, QVAR, amrex::The_Async_Arena());
-  amrex::FArrayBox qzp(bxg2, QVAR, amrex::The_Async_Arena());
-  auto const& qzmarr = qzm.array();
-  auto const& qzparr = qzp.array();
+  ws.qm[cdir].resize(zmbx, QVAR, amrex::The_Async_Arena());
+  ws.qp[cdir].resize(bxg2, QVAR, amrex::The_Async_Arena());
+  auto const& qzmarr = ws.qm[cdir].array();
+  auto const& qzparr = ws.qp[cdir].array();
 
   // Put the PLM and slopes in the same kernel launch to avoid unnecessary
   // launch overhead Pelec_Slope_* are SIMD as well as PeleC_plm_* which loop
@@ -150,56 +152,55 @@ pc_umeth_3D(
   // These are the first flux estimates as per the corner-transport-upwind
   // method X initial fluxes
   cdir = 0;
-  amrex::FArrayBox fx(xflxbx, NVAR, amrex::The_Async_Arena());
-  auto const& fxarr = fx.array();
-  amrex::FArrayBox qgdx(xflxbx, NGDNV, amrex::The_Async_Arena());
-  auto const& gdtempx = qgdx.array();
+  ws.flx[cdir].resize(xflxbx, NVAR, amrex::The_Async_Arena());
+  auto const& fxarr = ws.flx[cdir].array();
+  ws.qgd[cdir].resize(xflxbx, NGDNV, amrex::The_Async_Arena());
+  auto const& gdtempx = ws.qgd[cdir].array();
   amrex::ParallelFor(
     xflxbx, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
       pc_cmpflx(
         i, j, k, bclx, bchx, dlx, dhx, qxmarr, qxparr, fxarr, gdtempx, qaux,
-        cdir);
+        cdir, gamma_cache_tol);
     });
 
   // Y initial fluxes
   cdir = 1;
-  amrex::FArrayBox fy(yflxbx, NVAR, amrex::The_Async_Arena());
-  auto const& fyarr = fy.array();
-  amrex::FArrayBox qgdy(yflxbx, NGDNV, amrex::The_Async_Arena());
-  auto const& gdtempy = qgdy.array();
+  ws.flx[cdir].resize(yflxbx, NVAR, amrex::The_Async_Arena());
+  auto const& fyarr = ws.flx[cdir].array();
+  ws.qgd[cdir].resize(yflxbx, NGDNV, amrex::The_Async_Arena());
+  auto const& gdtempy = ws.qgd[cdir].array();
   amrex::ParallelFor(
     yflxbx, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
       pc_cmpflx(
         i, j, k, bcly, bchy, dly, dhy, qymarr, qyparr, fyarr, gdtempy, qaux,
-        cdir);
+        cdir, gamma_cache_tol);
     });
 
   // Z initial fluxes
   cdir = 2;
-  amrex::FArrayBox fz(zflxbx, NVAR, amrex::The_Async_Arena());
-  auto const& fzarr = fz.array();
-  amrex::FArrayBox qgdz(zflxbx, NGDNV, amrex::The_Async_Arena());
-  auto const& gdtempz = qgdz.array();
+  ws.flx[cdir].resize(zflxbx, NVAR, amrex::The_Async_Arena());
+  auto const& fzarr = ws.flx[cdir].array();
+  ws.qgd[cdir].resize(zflxbx, NGDNV, amrex::The_Async_Arena());
+  auto const& gdtempz = ws.qgd[cdir].array();
   amrex::ParallelFor(
     zflxbx, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
       pc_cmpflx(
         i, j, k, bclz, bchz, dlz, dhz, qzmarr, qzparr, fzarr, gdtempz, qaux,
-        cdir);
+        cdir, gamma_cache_tol);
     });
 
   // X interface corrections
   cdir = 0;
   const amrex::Box& txbx = grow(bxg1, cdir, 1);
   const amrex::Box& txbxm = growHi(txbx, cdir, 1);
-  amrex::FArrayBox qxym(txbxm, QVAR, amrex::The_Async_Arena());
-  amrex::FArrayBox qxyp(txbx, QVAR, amrex::The_Async_Arena());
-  auto const& qmxy = qxym.array();
-  auto const& qpxy = qxyp.array();
-
-  amrex::FArrayBox qxzm(txbxm, QVAR, amrex::The_Async_Arena());
-  amrex::FArrayBox qxzp(txbx, QVAR, amrex::The_Async_Arena());
-  auto const& qmxz = qxzm.array();
-  auto const& qpxz = qxzp.array();
+  ws.qt[0].resize(txbxm, QVAR, amrex::The_Async_Arena());
+  ws.qt[1].resize(txbx, QVAR, amrex::The_Async_Arena());
+  ws.qt[2].resize(txbxm, QVAR, amrex::The_Async_Arena());
+  ws.qt[3].resize(txbx, QVAR, amrex::The_Async_Arena());
+  auto const& qmxy = ws.qt[0].array();
+  auto const& qpxy = ws.qt[1].array();
+  auto const& qmxz = ws.qt[2].array();
+  auto const& qpxz = ws.qt[3].array();
 
   amrex::ParallelFor(txbx, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
     // X|Y
@@ -213,39 +214,42 @@ pc_umeth_3D(
   });
 
   const amrex::Box& txfxbx = surroundingNodes(bxg1, cdir);
-  amrex::FArrayBox fluxxy(txfxbx, NVAR, amrex::The_Async_Arena());
-  amrex::FArrayBox fluxxz(txfxbx, NVAR, amrex::The_Async_Arena());
-  amrex::FArrayBox gdvxyfab(txfxbx, NGDNV, amrex::The_Async_Arena());
-  amrex::FArrayBox gdvxzfab(txfxbx, NGDNV, amrex::The_Async_Arena());
+  ws.tflx[0].resize(txfxbx, NVAR, amrex::The_Async_Arena());
+  ws.tflx[1].resize(txfxbx, NVAR, amrex::The_Async_Arena());
+  ws.tqgd[0].resize(txfxbx, NGDNV, amrex::The_Async_Arena());
+  ws.tqgd[1].resize(txfxbx, NGDNV, amrex::The_Async_Arena());
 
-  auto const& flxy = fluxxy.array();
-  auto const& flxz = fluxxz.array();
-  auto const& qxy = gdvxyfab.array();
-  auto const& qxz = gdvxzfab.array();
+  auto const& flxy = ws.tflx[0].array();
+  auto const& flxz = ws.tflx[1].array();
+  auto const& qxy = ws.tqgd[0].array();
+  auto const& qxz = ws.tqgd[1].array();
 
   // Riemann problem X|Y X|Z
   amrex::ParallelFor(
     txfxbx, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
       // X|Y
       pc_cmpflx(
-        i, j, k, bclx, bchx, dlx, dhx, qmxy, qpxy, flxy, qxy, qaux, cdir);
+        i, j, k, bclx, bchx, dlx, dhx, qmxy, qpxy, flxy, qxy, qaux, cdir,
+        gamma_cache_tol);
       // X|Z
       pc_cmpflx(
-        i, j, k, bclx, bchx, dlx, dhx, qmxz, qpxz, flxz, qxz, qaux, cdir);
+        i, j, k, bclx, bchx, dlx, dhx, qmxz, qpxz, flxz, qxz, qaux, cdir,
+        gamma_cache_tol);
     });
 
   // Y interface corrections
   cdir = 1;
   const amrex::Box& tybx = grow(bxg1, cdir, 1);
   const amrex::Box& tybxm = growHi(tybx, cdir, 1);
-  amrex::FArrayBox qyxm(tybxm, QVAR, amrex::The_Async_Arena());
-  amrex::FArrayBox qyxp(tybx, QVAR, amrex::The_Async_Arena());
-  amrex::FArrayBox qyzm(tybxm, QVAR, amrex::The_Async_Arena());
-  amrex::FArrayBox qyzp(tybx, QVAR, amrex::The_Async_Arena());
-  auto const& qmyx = qyxm.array();
-  auto const& qpyx = qyxp.array();
-  auto const& qmyz = qyzm.array();
-  auto const& qpyz = qyzp.array();
+  // The X-corrected states are no longer needed
+  ws.qt[0].resize(tybxm, QVAR, amrex::The_Async_Arena());
+  ws.qt[1].resize(tybx, QVAR, amrex::The_Async_Arena());
+  ws.qt[2].resize(tybxm, QVAR, amrex::The_Async_Arena());
+  ws.qt[3].resize(tybx, QVAR, amrex::The_Async_Arena());
+  auto const& qmyx = ws.qt[0].array();
+  auto const& qpyx = ws.qt[1].array();
+  auto const& qmyz = ws.qt[2].array();
+  auto const& qpyz = ws.qt[3].array();
 
   amrex::ParallelFor(tybx, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
     // Y|X
@@ -260,39 +264,42 @@ pc_umeth_3D(
 
   // Riemann problem Y|X Y|Z
   const amrex::Box& tyfxbx = surroundingNodes(bxg1, cdir);
-  amrex::FArrayBox fluxyx(tyfxbx, NVAR, amrex::The_Async_Arena());
-  amrex::FArrayBox fluxyz(tyfxbx, NVAR, amrex::The_Async_Arena());
-  amrex::FArrayBox gdvyxfab(tyfxbx, NGDNV, amrex::The_Async_Arena());
-  amrex::FArrayBox gdvyzfab(tyfxbx, NGDNV, amrex::The_Async_Arena());
+  ws.tflx[2].resize(tyfxbx, NVAR, amrex::The_Async_Arena());
+  ws.tflx[3].resize(tyfxbx, NVAR, amrex::The_Async_Arena());
+  ws.tqgd[2].resize(tyfxbx, NGDNV, amrex::The_Async_Arena());
+  ws.tqgd[3].resize(tyfxbx, NGDNV, amrex::The_Async_Arena());
 
-  auto const& flyx = fluxyx.array();
-  auto const& flyz = fluxyz.array();
-  auto const& qyx = gdvyxfab.array();
-  auto const& qyz = gdvyzfab.array();
+  auto const& flyx = ws.tflx[2].array();
+  auto const& flyz = ws.tflx[3].array();
+  auto const& qyx = ws.tqgd[2].array();
+  auto const& qyz = ws.tqgd[3].array();
 
   amrex::ParallelFor(
     tyfxbx, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
       // Y|X
       pc_cmpflx(
-        i, j, k, bcly, bchy, dly, dhy, qmyx, qpyx, flyx, qyx, qaux, cdir);
+        i, j, k, bcly, bchy, dly, dhy, qmyx, qpyx, flyx, qyx, qaux, cdir,
+        gamma_cache_tol);
       // Y|Z
       pc_cmpflx(
-        i, j, k, bcly, bchy, dly, dhy, qmyz, qpyz, flyz, qyz, qaux, cdir);
+        i, j, k, bcly, bchy, dly, dhy, qmyz, qpyz, flyz, qyz, qaux, cdir,
+        gamma_cache_tol);
     });
 
   // Z interface corrections
   cdir = 2;
   const amrex::Box& tzbx = grow(bxg1, cdir, 1);
   const amrex::Box& tzbxm = growHi(tzbx, cdir, 1);
-  amrex::FArrayBox qzxm(tzbxm, QVAR, amrex::The_Async_Arena());
-  amrex::FArrayBox qzxp(tzbx, QVAR, amrex::The_Async_Arena());
-  amrex::FArrayBox qzym(tzbxm, QVAR, amrex::The_Async_Arena());
-  amrex::FArrayBox qzyp(tzbx, QVAR, amrex::The_Async_Arena());
+  // The Y-corrected states are no longer needed
+  ws.qt[0].resize(tzbxm, QVAR, amrex::The_Async_Arena());
+  ws.qt[1].resize(tzbx, QVAR, amrex::The_Async_Arena());
+  ws.qt[2].resize(tzbxm, QVAR, amrex::The_Async_Arena());
+  ws.qt[3].resize(tzbx, QVAR, amrex::The_Async_Arena());
 
-  auto const& qmzx = qzxm.array();
-  auto const& qpzx = qzxp.array();
-  auto const& qmzy = qzym.array();
-  auto const& qpzy = qzyp.array();
+  auto const& qmzx = ws.qt[0].array();
+  auto const& qpzx = ws.qt[1].array();
+  auto const& qmzy = ws.qt[2].array();
+  auto const& qpzy = ws.qt[3].array();
 
   amrex::ParallelFor(tzbx, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
     // Z|X
@@ -306,37 +313,42 @@ pc_umeth_3D(
   });
 
   // Riemann problem Z|X Z|Y
+  // The first X and Y flux estimates were last used by the Z interface
+  // corrections, so their buffers hold the Z transverse fluxes
   const amrex::Box& tzfxbx = surroundingNodes(bxg1, cdir);
-  amrex::FArrayBox fluxzx(tzfxbx, NVAR, amrex::The_Async_Arena());
-  amrex::FArrayBox fluxzy(tzfxbx, NVAR, amrex::The_Async_Arena());
-  amrex::FArrayBox gdvzxfab(tzfxbx, NGDNV, amrex::The_Async_Arena());
-  amrex::FArrayBox gdvzyfab(tzfxbx, NGDNV, amrex::The_Async_Arena());
+  ws.flx[0].resize(tzfxbx, NVAR, amrex::The_Async_Arena());
+  ws.flx[1].resize(tzfxbx, NVAR, amrex::The_Async_Arena());
+  ws.qgd[0].resize(tzfxbx, NGDNV, amrex::The_Async_Arena());
+  ws.qgd[1].resize(tzfxbx, NGDNV, amrex::The_Async_Arena());
 
-  auto const& flzx = fluxzx.array();
-  auto const& flzy = fluxzy.array();
-  auto const& qzx = gdvzxfab.array();
-  auto const& qzy = gdvzyfab.array();
+  auto const& flzx = ws.flx[0].array();
+  auto const& flzy = ws.flx[1].array();
+  auto const& qzx = ws.qgd[0].array();
+  auto const& qzy = ws.qgd[1].array();
 
   amrex::ParallelFor(
     tzfxbx, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
       // Z|X
       pc_cmpflx(
-        i, j, k, bclz, bchz, dlz, dhz, qmzx, qpzx, flzx, qzx, qaux, cdir);
+        i, j, k, bclz, bchz, dlz, dhz, qmzx, qpzx, flzx, qzx, qaux, cdir,
+        gamma_cache_tol);
       // Z|Y
       pc_cmpflx(
-        i, j, k, bclz, bchz, dlz, dhz, qmzy, qpzy, flzy, qzy, qaux, cdir);
+        i, j, k, bclz, bchz, dlz, dhz, qmzy, qpzy, flzy, qzy, qaux, cdir,
+        gamma_cache_tol);
     });
 
-  // Temp Fabs for Final Fluxes
-  amrex::FArrayBox qmfab(bxg2, QVAR, amrex::The_Async_Arena());
-  amrex::FArrayBox qpfab(bxg1, QVAR, amrex::The_Async_Arena());
-  auto const& qm = qmfab.array();
-  auto const& qp = qpfab.array();
+  // Final face states go in the transverse state buffers
+  ws.peak_bytes = amrex::max(ws.peak_bytes, ws.nBytes());
 
   // X | Y&Z
   cdir = 0;
   const amrex::Box& xfxbx = surroundingNodes(bx, cdir);
   const amrex::Box& tyzbx = grow(bx, cdir, 1);
+  ws.qt[0].resize(growHi(tyzbx, cdir, 1), QVAR, amrex::The_Async_Arena());
+  ws.qt[1].resize(tyzbx, QVAR, amrex::The_Async_Arena());
+  auto const& qm = ws.qt[0].array();
+  auto const& qp = ws.qt[1].array();
   amrex::ParallelFor(tyzbx, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
     pc_transdd(
       AMREX_D_DECL(i, j, k), cdir, qm, qp, qxmarr, qxparr, flyz, flzy, qyz, qzy,
@@ -345,37 +357,51 @@ pc_umeth_3D(
 
   // Final X flux
   amrex::ParallelFor(xfxbx, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
-    pc_cmpflx(i, j, k, bclx, bchx, dlx, dhx, qm, qp, flx1, q1, qaux, cdir);
+    pc_cmpflx(
+      i, j, k, bclx, bchx, dlx, dhx, qm, qp, flx1, q1, qaux, cdir,
+      gamma_cache_tol);
   });
 
   // Y | X&Z
   cdir = 1;
   const amrex::Box& yfxbx = surroundingNodes(bx, cdir);
   const amrex::Box& txzbx = grow(bx, cdir, 1);
+  ws.qt[2].resize(growHi(txzbx, cdir, 1), QVAR, amrex::The_Async_Arena());
+  ws.qt[3].resize(txzbx, QVAR, amrex::The_Async_Arena());
+  auto const& qmy = ws.qt[2].array();
+  auto const& qpy = ws.qt[3].array();
   amrex::ParallelFor(txzbx, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
     pc_transdd(
-      AMREX_D_DECL(i, j, k), cdir, qm, qp, qymarr, qyparr, flxz, flzx, qxz, qzx,
-      qaux, srcQ, hdt, hdtdx, hdtdz);
+      AMREX_D_DECL(i, j, k), cdir, qmy, qpy, qymarr, qyparr, flxz, flzx, qxz,
+      qzx, qaux, srcQ, hdt, hdtdx, hdtdz);
   });
 
   // Final Y flux
   amrex::ParallelFor(yfxbx, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
-    pc_cmpflx(i, j, k, bcly, bchy, dly, dhy, qm, qp, flx2, q2, qaux, cdir);
+    pc_cmpflx(
+      i, j, k, bcly, bchy, dly, dhy, qmy, qpy, flx2, q2, qaux, cdir,
+      gamma_cache_tol);
   });
 
   // Z | X&Y
   cdir = 2;
   const amrex::Box& zfxbx = surroundingNodes(bx, cdir);
   const amrex::Box& txybx = grow(bx, cdir, 1);
+  ws.qt[0].resize(growHi(txybx, cdir, 1), QVAR, amrex::The_Async_Arena());
+  ws.qt[1].resize(txybx, QVAR, amrex::The_Async_Arena());
+  auto const& qmz = ws.qt[0].array();
+  auto const& qpz = ws.qt[1].array();
   amrex::ParallelFor(txybx, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
     pc_transdd(
-      AMREX_D_DECL(i, j, k), cdir, qm, qp, qzmarr, qzparr, flxy, flyx, qxy, qyx,
-      qaux, srcQ, hdt, hdtdx, hdtdy);
+      AMREX_D_DECL(i, j, k), cdir, qmz, qpz, qzmarr, qzparr, flxy, flyx, qxy,
+      qyx, qaux, srcQ, hdt, hdtdx, hdtdy);
   });
 
   // Final Z flux
   amrex::ParallelFor(zfxbx, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
-    pc_cmpflx(i, j, k, bclz, bchz, dlz, dhz, qm, qp, flx3, q3, qaux, cdir);
+    pc_cmpflx(
+      i, j, k, bclz, bchz, dlz, dhz, qmz, qpz, flx3, q3, qaux, cdir,
+      gamma_cache_tol);
   });
 
   // Construct p div{U}
@@ -412,7 +438,8 @@ pc_umeth_2D(
   const int ppm_type,
   const bool use_flattening,
   const bool use_hybrid_weno,
-  const int weno_scheme)
+  const int weno_scheme,
+  const amrex::Real gamma_cache_tol)
 {
   amrex::Real const dx = del[0];
   amrex::Real const dy = del[1];
@@ -498,7 +525,7 @@ pc_umeth_2D(
     xflxbx, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
       pc_cmpflx(
         i, j, k, bclx, bchx, dlx, dhx, qxmarr, qxparr, fxarr, gdtemp, qaux,
-        cdir);
+        cdir, gamma_cache_tol);
     });
 
   // Y initial fluxes
@@ -508,7 +535,8 @@ pc_umeth_2D(
   amrex::ParallelFor(
     yflxbx, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
       pc_cmpflx(
-        i, j, k, bcly, bchy, dly, dhy, qymarr, qyparr, fyarr, q2, qaux, cdir);
+        i, j, k, bcly, bchy, dly, dhy, qymarr, qyparr, fyarr, q2, qaux, cdir,
+        gamma_cache_tol);
     });
 
   // X interface corrections
@@ -532,7 +560,8 @@ pc_umeth_2D(
   // Final Riemann problem X
   amrex::ParallelFor(xfxbx, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
     pc_cmpflx(
-      i, j, k, bclx, bchx, dlx, dhx, qmarr, qparr, flx1, q1, qaux, cdir);
+      i, j, k, bclx, bchx, dlx, dhx, qmarr, qparr, flx1, q1, qaux, cdir,
+      gamma_cache_tol);
   });
 
   // Y interface corrections
@@ -551,7 +580,8 @@ pc_umeth_2D(
   const amrex::Box& yfxbx = surroundingNodes(bx, cdir);
   amrex::ParallelFor(yfxbx, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
     pc_cmpflx(
-      i, j, k, bcly, bchy, dly, dhy, qmarr, qparr, flx2, q2, qaux, cdir);
+      i, j, k, bcly, bchy, dly, dhy, qmarr, qparr, flx2, q2, qaux, cdir,
+      gamma_cache_tol);
   });
 
   // Construct p div{U}
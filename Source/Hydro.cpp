@@ -27,20 +27,19 @@ PeleC::construct_hydro_source(
     sources_for_hydro.setVal(0.0);
     int ng = 0; // TODO: This is currently the largest ngrow of the source
                 // data...maybe this needs fixing?
+    amrex::Vector<StateUpdateTerm> terms;
     for (int n = 0; n < src_list.size(); ++n) {
-      amrex::MultiFab::Saxpy(
-        sources_for_hydro, 0.5, *new_sources[src_list[n]], 0, 0, NVAR, ng);
-      amrex::MultiFab::Saxpy(
-        sources_for_hydro, 0.5, *old_sources[src_list[n]], 0, 0, NVAR, ng);
+      terms.push_back({new_sources[src_list[n]].get(), 0.5, 0, 0, NVAR});
+      terms.push_back({old_sources[src_list[n]].get(), 0.5, 0, 0, NVAR});
     }
     // Add I_R terms to advective forcing
     if (do_react) {
-      amrex::MultiFab::Add(
-        sources_for_hydro, get_new_data(Reactions_Type), 0, FirstSpec,
-        NUM_SPECIES, ng);
-      amrex::MultiFab::Add(
-        sources_for_hydro, get_new_data(Reactions_Type), NUM_SPECIES, Eden, 1,
-        ng);
+      const amrex::MultiFab& I_R = get_new_data(Reactions_Type);
+      terms.push_back({&I_R, 1.0, 0, FirstSpec, NUM_SPECIES});
+      terms.push_back({&I_R, 1.0, NUM_SPECIES, Eden, 1});
+    }
+    if (!terms.empty()) {
+      fused_state_update(sources_for_hydro, terms, ng, false);
     }
     sources_for_hydro.FillBoundary(geom.periodicity());
     hydro_source.setVal(0);
@@ -60,6 +59,8 @@ PeleC::construct_hydro_source(
 
     amrex::Real courno = std::numeric_limits<amrex::Real>::lowest();
 
+    build_primitive_cache(S, numGrow() + nGrowF, false);
+
     const amrex::MultiFab& S_new = get_new_data(State_Type);
 
     // note: the radiation consup currently does not fill these
@@ -76,6 +77,7 @@ PeleC::construct_hydro_source(
     amrex::Real xang_lost = 0.;
     amrex::Real yang_lost = 0.;
     amrex::Real zang_lost = 0.;
+    amrex::Long ctu_peak_bytes = 0;
 
 #ifdef AMREX_USE_OMP
 #pragma omp parallel if (amrex::Gpu::notInLaunchRegion())               \
@@ -83,10 +85,11 @@ PeleC::construct_hydro_source(
     reduction(+:xmom_added_flux,ymom_added_flux,zmom_added_flux)	\
     reduction(+:mass_lost,xmom_lost,ymom_lost,zmom_lost)		\
     reduction(+:eden_lost,xang_lost,yang_lost,zang_lost) 		\
-    reduction(max:courno)
+    reduction(max:courno,ctu_peak_bytes)
 #endif
     {
       amrex::Real cflLoc = std::numeric_limits<amrex::Real>::lowest();
+      CTUWorkspace ctu_ws;
       int is_finest_level = (level == finest_level) ? 1 : 0;
 
       const int* domain_lo = geom.Domain().loVect();
@@ -110,22 +113,12 @@ PeleC::construct_hydro_source(
         auto const& hyd_src = hydro_source.array(mfi);
 
         // Resize Temporary Fabs
-        amrex::FArrayBox q(qbx, QVAR, amrex::The_Async_Arena());
-        amrex::FArrayBox qaux(qbx, NQAUX, amrex::The_Async_Arena());
         amrex::FArrayBox src_q(qbx, QVAR, amrex::The_Async_Arena());
         // Get Arrays to pass to the gpu.
-        auto const& qarr = q.array();
-        auto const& qauxar = qaux.array();
+        auto const& qarr = prim_q.const_array(mfi);
+        auto const& qauxar = prim_qaux.const_array(mfi);
         auto const& srcqarr = src_q.array();
 
-        {
-          BL_PROFILE("PeleC::ctoprim()");
-          amrex::ParallelFor(
-            qbx, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
-              pc_ctoprim(i, j, k, s, qarr, qauxar);
-            });
-        }
-
         // TODO GPUize NCSCBC
         // Imposing Ghost-Cells Navier-Stokes Characteristic BCs if "UserBC" are
         // used For the theory, see Motheau et al. AIAA J. Vol. 55, No. 10 : pp.
@@ -196,8 +189,15 @@ PeleC::construct_hydro_source(
           pc_umdrv(
             is_finest_level, time, fbx, domain_lo, domain_hi, phys_bc.lo(),
             phys_bc.hi(), s, hyd_src, qarr, qauxar, srcqarr, dx, dt, ppm_type,
-            use_flattening, use_hybrid_weno, weno_scheme, difmag, flx_arr, a,
-            volume.array(mfi), cflLoc);
+            use_flattening, use_hybrid_weno, weno_scheme,
+            riemann_gamma_cache ? riemann_gamma_cache_tol : -1.0, difmag,
+            flx_arr, a, volume.array(mfi), cflLoc, ctu_ws);
+        }
+        ctu_peak_bytes = amrex::max(ctu_peak_bytes, ctu_ws.peak_bytes);
+        if (amrex::Gpu::inLaunchRegion()) {
+          // Tiles may run on different streams, so only keep the
+          // workspace within a tile
+          ctu_ws.clear();
         }
 
         courno = amrex::max<amrex::Real>(courno, cflLoc);
@@ -252,6 +252,14 @@ PeleC::construct_hydro_source(
       }
     }
 
+    if (verbose > 1) {
+      amrex::ParallelDescriptor::ReduceLongMax(
+        ctu_peak_bytes, amrex::ParallelDescriptor::IOProcessorNumber());
+      amrex::Print() << "... Peak CTU scratch memory per tile: "
+                     << static_cast<amrex::Real>(ctu_peak_bytes) / 1.0e6
+                     << " MB" << std::endl;
+    }
+
     if (track_grid_losses) {
       material_lost_through_boundary_temp[0] += mass_lost;
       material_lost_through_boundary_temp[1] += xmom_lost;
@@ -324,12 +332,14 @@ pc_umdrv(
   const bool use_flattening,
   const bool use_hybrid_weno,
   const int weno_scheme,
+  const amrex::Real gamma_cache_tol,
   const amrex::Real difmag,
   const amrex::GpuArray<const amrex::Array4<amrex::Real>, AMREX_SPACEDIM>& flx,
   const amrex::GpuArray<const amrex::Array4<const amrex::Real>, AMREX_SPACEDIM>&
     a,
   amrex::Array4<amrex::Real> const& vol,
-  amrex::Real /*cflLoc*/)
+  amrex::Real /*cflLoc*/,
+  CTUWorkspace& ctu_ws)
 {
   // Set Up for Hydro Flux Calculations
   auto const& bxg2 = grow(bx, 2);
@@ -351,6 +361,7 @@ pc_umdrv(
     BL_PROFILE("PeleC::umeth()");
 #if AMREX_SPACEDIM == 1
     amrex::Abort("PLM isn't implemented in 1D.");
+    amrex::ignore_unused(ctu_ws);
     // pc_umeth_1D(
     //  bx, bclo, bchi, domlo, domhi, q, qaux, src_q, // bcMask,
     //  flx[0], qec_arr[0], a[0], pdivuarr, vol, dx, dt);
@@ -358,13 +369,14 @@ pc_umdrv(
     pc_umeth_2D(
       bx, bclo, bchi, domlo, domhi, q, qaux, src_q, // bcMask,
       flx[0], flx[1], qec_arr[0], qec_arr[1], a[0], a[1], pdivuarr, vol, dx, dt,
-      ppm_type, use_flattening, use_hybrid_weno, weno_scheme);
+      ppm_type, use_flattening, use_hybrid_weno, weno_scheme, gamma_cache_tol);
+    amrex::ignore_unused(ctu_ws);
 #elif AMREX_SPACEDIM == 3
     pc_umeth_3D(
       bx, bclo, bchi, domlo, domhi, q, qaux, src_q, // bcMask,
       flx[0], flx[1], flx[2], qec_arr[0], qec_arr[1], qec_arr[2], a[0], a[1],
       a[2], pdivuarr, vol, dx, dt, ppm_type, use_flattening, use_hybrid_weno,
-      weno_scheme);
+      weno_scheme, gamma_cache_tol, ctu_ws);
 #endif
   }
 
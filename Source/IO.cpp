@@ -18,6 +18,7 @@
 
 #include "PeleC.H"
 #include "IO.H"
+#include "QuantizedPlotFile.H"
 #include "IndexDefines.H"
 
 #ifdef PELEC_USE_SPRAY
@@ -750,13 +751,17 @@ PeleC::writeBuildInfo(std::ostream& os)
   os << "\n\n";
 }
 
+namespace {
+// Fill rho, u, T and Y of S_new from a regular or quantized plotfile
+template <class PltData>
 void
-PeleC::initLevelDataFromPlt(
-  const int lev, const std::string& dataPltFile, amrex::MultiFab& S_new)
+fill_primitives_from_plt(
+  PltData& pltData,
+  const int lev,
+  const amrex::Geometry& geom,
+  const amrex::Vector<std::string>& spec_names,
+  amrex::MultiFab& S_new)
 {
-  amrex::Print() << "Using data (rho, u, T, Y) from pltfile " << dataPltFile
-                 << std::endl;
-  pele::physics::pltfilemanager::PltFileManager pltData(dataPltFile);
   const auto plt_vars = pltData.getVariableList();
 
   // Read rho, u, temperature (required)
@@ -781,6 +786,22 @@ PeleC::initLevelDataFromPlt(
       pltData.fillPatchFromPlt(lev, geom, pos, UFS + n, 1, S_new);
     }
   }
+}
+} // namespace
+
+void
+PeleC::initLevelDataFromPlt(
+  const int lev, const std::string& dataPltFile, amrex::MultiFab& S_new)
+{
+  amrex::Print() << "Using data (rho, u, T, Y) from pltfile " << dataPltFile
+                 << std::endl;
+  if (pc_is_quantized_plotfile(dataPltFile)) {
+    QuantizedPltFile pltData(dataPltFile);
+    fill_primitives_from_plt(pltData, lev, geom, spec_names, S_new);
+  } else {
+    pele::physics::pltfilemanager::PltFileManager pltData(dataPltFile);
+    fill_primitives_from_plt(pltData, lev, geom, spec_names, S_new);
+  }
 
   // Sanity check the species, clean them up if they aren't too bad
   auto sarrs = S_new.arrays();
@@ -1,3 +1,4 @@
+#include <map>
 #include <memory>
 
 #include "hydro_redistribution.H"
@@ -47,6 +48,7 @@ PeleC::initialize_eb2_structs()
 {
   BL_PROFILE("PeleC::initialize_eb2_structs()");
   amrex::Print() << "Initializing EB2 structs" << std::endl;
+  const amrex::Real strt_time = amrex::ParallelDescriptor::second();
 
   static_assert(
     std::is_standard_layout<EBBndryGeom>::value,
@@ -66,6 +68,9 @@ PeleC::initialize_eb2_structs()
   sv_eb_bndry_grad_stencil.resize(vfrac.local_size());
   sv_eb_flux.resize(vfrac.local_size());
   sv_eb_bcval.resize(vfrac.local_size());
+  for (int dir = 0; dir < AMREX_SPACEDIM; ++dir) {
+    flux_interp_stencil[dir].resize(vfrac.local_size());
+  }
 
   auto const& flags = ebfactory.getMultiEBCellFlagFab();
 
@@ -85,6 +90,19 @@ PeleC::initialize_eb2_structs()
     amrex::Abort();
   }
 
+  // Boxes that were already present on this level before the regrid reuse
+  // their stencils (the EB geometry and the stencil type do not change
+  // during a run, so the level and box identify them). The level being
+  // replaced is discarded once this one is built, so its stencils are moved
+  // rather than copied: no stencil is ever held twice.
+  bool use_stencil_cache = true;
+  pp.query("use_stencil_cache", use_stencil_cache);
+  std::map<amrex::Box, EBStencilCacheEntry> level_cache;
+  if (use_stencil_cache) {
+    take_eb_stencils_of_old_level(level_cache);
+  }
+  amrex::Vector<int> from_cache(vfrac.local_size(), 0);
+
 #ifdef AMREX_USE_OMP
 #pragma omp parallel if (amrex::Gpu::notInLaunchRegion())
 #endif
@@ -99,73 +117,98 @@ PeleC::initialize_eb2_structs()
       // do nothing
     } else if (typ == amrex::FabType::singlevalued) {
       const int Ncut = flagfab.getNumCutCells(tbox);
-      sv_eb_bndry_geom[iLocal].resize(Ncut);
-      auto const& flag_arr = flags.const_array(mfi);
-      EBBndryGeom* d_sv_eb_bndry_geom = sv_eb_bndry_geom[iLocal].data();
-      const auto lo = amrex::lbound(tbox);
-      const auto hi = amrex::ubound(tbox);
-      amrex::ParallelFor(1, [=] AMREX_GPU_DEVICE(int /*dummy*/) noexcept {
-        int ivec = 0;
-        for (int i = lo.x; i <= hi.x; ++i) {
-          for (int j = lo.y; j <= hi.y; ++j) {
-            for (int k = lo.z; k <= hi.z; ++k) {
-              const amrex::IntVect iv(AMREX_D_DECL(i, j, k));
-              const amrex::EBCellFlag& flag = flag_arr(iv);
-              if (!(flag.isRegular() || flag.isCovered())) {
-                d_sv_eb_bndry_geom[ivec].iv = iv;
-                ivec++;
-              }
-            }
-          }
+      const auto cached =
+        use_stencil_cache ? level_cache.find(tbox) : level_cache.end();
+      if (
+        (cached != level_cache.end()) &&
+        (static_cast<int>(cached->second.bndry_geom.size()) == Ncut)) {
+        sv_eb_bndry_geom[iLocal] = std::move(cached->second.bndry_geom);
+        sv_eb_bndry_grad_stencil[iLocal] =
+          std::move(cached->second.bndry_grad_stencil);
+        for (int dir = 0; dir < AMREX_SPACEDIM; ++dir) {
+          flux_interp_stencil[dir][iLocal] =
+            std::move(cached->second.flux_interp_stencil[dir]);
         }
-      });
-
-      // Now fill the sv_eb_bndry_geom
-      auto const& vfrac_arr = vfrac.array(mfi);
-      auto const& bndrycent_arr = bndrycent->array(mfi);
-      AMREX_D_TERM(auto const& areafrac_arr_0 = areafrac[0]->array(mfi);
-                   , auto const& areafrac_arr_1 = areafrac[1]->array(mfi);
-                   , auto const& areafrac_arr_2 = areafrac[2]->array(mfi);)
-      pc_fill_sv_ebg(
-        tbox, Ncut, vfrac_arr, bndrycent_arr,
-        AMREX_D_DECL(areafrac_arr_0, areafrac_arr_1, areafrac_arr_2),
-        sv_eb_bndry_geom[iLocal].data());
-
-      sv_eb_bndry_grad_stencil[iLocal].resize(Ncut);
-
-      // Fill in boundary gradient for cut cells in this grown tile
-      const amrex::Real dx = geom.CellSize()[0];
+        from_cache[iLocal] = 1;
+      } else {
+        sv_eb_bndry_geom[iLocal].resize(Ncut);
+        auto const& flag_arr = flags.const_array(mfi);
+        EBBndryGeom* d_sv_eb_bndry_geom = sv_eb_bndry_geom[iLocal].data();
+        // Gather the cut cells with a prefix sum over the tile. Cells are
+        // visited in Box offset order (x fastest), which is also the IntVect
+        // ordering, so the list comes out sorted.
+        amrex::Scan::PrefixSum<int>(
+          static_cast<int>(tbox.numPts()),
+          [=] AMREX_GPU_DEVICE(int icell) -> int {
+            const amrex::EBCellFlag& flag = flag_arr(tbox.atOffset(icell));
+            return static_cast<int>(!(flag.isRegular() || flag.isCovered()));
+          },
+          [=] AMREX_GPU_DEVICE(int icell, int const& x) {
+            const amrex::IntVect iv = tbox.atOffset(icell);
+            const amrex::EBCellFlag& flag = flag_arr(iv);
+            if (!(flag.isRegular() || flag.isCovered())) {
+              d_sv_eb_bndry_geom[x].iv = iv;
+            }
+          },
+          amrex::Scan::Type::exclusive, amrex::Scan::noRetSum);
+
+        // Now fill the sv_eb_bndry_geom
+        auto const& vfrac_arr = vfrac.array(mfi);
+        auto const& bndrycent_arr = bndrycent->array(mfi);
+        AMREX_D_TERM(auto const& areafrac_arr_0 = areafrac[0]->array(mfi);
+                     , auto const& areafrac_arr_1 = areafrac[1]->array(mfi);
+                     , auto const& areafrac_arr_2 = areafrac[2]->array(mfi);)
+        pc_fill_sv_ebg(
+          tbox, Ncut, vfrac_arr, bndrycent_arr,
+          AMREX_D_DECL(areafrac_arr_0, areafrac_arr_1, areafrac_arr_2),
+          sv_eb_bndry_geom[iLocal].data());
+
+        sv_eb_bndry_grad_stencil[iLocal].resize(Ncut);
+
+        // Fill in boundary gradient for cut cells in this grown tile
+        const amrex::Real dx = geom.CellSize()[0];
+
+        // The gather above should already be sorted; only sort if the IntVect
+        // ordering disagrees with the Box offset ordering
+        const int nunsorted = amrex::Reduce::Sum<int>(
+          amrex::max(Ncut - 1, 0), [=] AMREX_GPU_DEVICE(int i) noexcept -> int {
+            return static_cast<int>(
+              d_sv_eb_bndry_geom[i + 1].iv < d_sv_eb_bndry_geom[i].iv);
+          });
+        if (nunsorted > 0) {
 #if defined(AMREX_USE_CUDA) || defined(AMREX_USE_HIP)
-      const int sv_eb_bndry_geom_size = sv_eb_bndry_geom[iLocal].size();
-      thrust::sort(
-        thrust::device, sv_eb_bndry_geom[iLocal].data(),
-        sv_eb_bndry_geom[iLocal].data() + sv_eb_bndry_geom_size,
-        EBBndryGeomCmp());
+          const int sv_eb_bndry_geom_size = sv_eb_bndry_geom[iLocal].size();
+          thrust::sort(
+            thrust::device, sv_eb_bndry_geom[iLocal].data(),
+            sv_eb_bndry_geom[iLocal].data() + sv_eb_bndry_geom_size,
+            EBBndryGeomCmp());
 #elif defined(AMREX_USE_SYCL)
-      const int sv_eb_bndry_geom_size = sv_eb_bndry_geom[iLocal].size();
-      auto policy =
-        dpl::execution::make_device_policy(amrex::Gpu::Device::streamQueue());
-      std::sort(
-        policy, sv_eb_bndry_geom[iLocal].data(),
-        sv_eb_bndry_geom[iLocal].data() + sv_eb_bndry_geom_size,
-        EBBndryGeomCmp());
+          const int sv_eb_bndry_geom_size = sv_eb_bndry_geom[iLocal].size();
+          auto policy = dpl::execution::make_device_policy(
+            amrex::Gpu::Device::streamQueue());
+          std::sort(
+            policy, sv_eb_bndry_geom[iLocal].data(),
+            sv_eb_bndry_geom[iLocal].data() + sv_eb_bndry_geom_size,
+            EBBndryGeomCmp());
 #else
-      sort<amrex::Gpu::DeviceVector<EBBndryGeom>>(sv_eb_bndry_geom[iLocal]);
+          sort<amrex::Gpu::DeviceVector<EBBndryGeom>>(sv_eb_bndry_geom[iLocal]);
 #endif
+        }
 
-      if (bgs == 0) {
-        pc_fill_bndry_grad_stencil_quadratic(
-          tbox, dx, Ncut, sv_eb_bndry_geom[iLocal].data(), Ncut,
-          sv_eb_bndry_grad_stencil[iLocal].data());
-      } else if (bgs == 1) {
-        pc_fill_bndry_grad_stencil_ls(
-          tbox, dx, Ncut, sv_eb_bndry_geom[iLocal].data(), Ncut,
-          flags.array(mfi), sv_eb_bndry_grad_stencil[iLocal].data());
-      } else {
-        amrex::Print()
-          << "Unknown or unspecified boundary gradient stencil type:" << bgs
-          << std::endl;
-        amrex::Abort();
+        if (bgs == 0) {
+          pc_fill_bndry_grad_stencil_quadratic(
+            tbox, dx, Ncut, sv_eb_bndry_geom[iLocal].data(), Ncut,
+            sv_eb_bndry_grad_stencil[iLocal].data());
+        } else if (bgs == 1) {
+          pc_fill_bndry_grad_stencil_ls(
+            tbox, dx, Ncut, sv_eb_bndry_geom[iLocal].data(), Ncut,
+            flags.array(mfi), sv_eb_bndry_grad_stencil[iLocal].data());
+        } else {
+          amrex::Print()
+            << "Unknown or unspecified boundary gradient stencil type:" << bgs
+            << std::endl;
+          amrex::Abort();
+        }
       }
 
       sv_eb_flux[iLocal].define(sv_eb_bndry_grad_stencil[iLocal], NVAR);
@@ -188,8 +231,6 @@ PeleC::initialize_eb2_structs()
   amrex::Box fbox[AMREX_SPACEDIM];
 
   for (int dir = 0; dir < AMREX_SPACEDIM; ++dir) {
-    flux_interp_stencil[dir].resize(vfrac.local_size());
-
     fbox[dir] = amrex::bdryLo(
       amrex::Box(
         amrex::IntVect(AMREX_D_DECL(0, 0, 0)),
@@ -211,16 +252,22 @@ PeleC::initialize_eb2_structs()
       amrex::FabType typ = flagfab.getType(tbox);
       int iLocal = mfi.LocalIndex();
 
-      if (typ == amrex::FabType::singlevalued) {
+      if ((typ == amrex::FabType::singlevalued) && (from_cache[iLocal] == 0)) {
         const auto afrac_arr = (*areafrac[dir])[mfi].array();
         const auto facecent_arr = (*facecent[dir])[mfi].array();
 
         // This used to be an std::set for cut_faces (it ensured
         // sorting and uniqueness)
         EBBndryGeom* d_sv_eb_bndry_geom = sv_eb_bndry_geom[iLocal].data();
-        const int Nall_cut_faces = amrex::Reduce::Sum<int>(
-          sv_eb_bndry_geom[iLocal].size(),
-          [=] AMREX_GPU_DEVICE(int i) noexcept -> int {
+        const int sv_eb_bndry_geom_size =
+          static_cast<int>(sv_eb_bndry_geom[iLocal].size());
+
+        // Count the cut faces of each cut cell, then scatter them with a
+        // prefix sum over the cut cells
+        amrex::Gpu::DeviceVector<int> v_nfaces(sv_eb_bndry_geom_size);
+        int* nfaces = v_nfaces.data();
+        amrex::ParallelFor(
+          sv_eb_bndry_geom_size, [=] AMREX_GPU_DEVICE(int i) noexcept {
             int r = 0;
             const amrex::IntVect& iv = d_sv_eb_bndry_geom[i].iv;
             for (int iside = 0; iside <= 1; iside++) {
@@ -229,19 +276,23 @@ PeleC::initialize_eb2_structs()
                 r++;
               }
             }
-            return r;
+            nfaces[i] = r;
           });
 
+        amrex::Gpu::DeviceVector<int> v_face_offsets(sv_eb_bndry_geom_size);
+        int* face_offsets = v_face_offsets.data();
+        const int Nall_cut_faces = amrex::Scan::PrefixSum<int>(
+          sv_eb_bndry_geom_size,
+          [=] AMREX_GPU_DEVICE(int i) -> int { return nfaces[i]; },
+          [=] AMREX_GPU_DEVICE(int i, int const& x) { face_offsets[i] = x; },
+          amrex::Scan::Type::exclusive, amrex::Scan::retSum);
+
         amrex::Gpu::DeviceVector<amrex::IntVect> v_all_cut_faces(
           Nall_cut_faces);
         amrex::IntVect* all_cut_faces = v_all_cut_faces.data();
-
-        const int sv_eb_bndry_geom_size =
-          static_cast<int>(sv_eb_bndry_geom[iLocal].size());
-        // Serial loop on the GPU
-        amrex::ParallelFor(1, [=] AMREX_GPU_DEVICE(int /*dummy*/) {
-          int cnt = 0;
-          for (int i = 0; i < sv_eb_bndry_geom_size; i++) {
+        amrex::ParallelFor(
+          sv_eb_bndry_geom_size, [=] AMREX_GPU_DEVICE(int i) noexcept {
+            int cnt = face_offsets[i];
             const amrex::IntVect& iv = d_sv_eb_bndry_geom[i].iv;
             for (int iside = 0; iside <= 1; iside++) {
               const amrex::IntVect iv_face = iv + iside * amrex::BASISV(dir);
@@ -250,8 +301,7 @@ PeleC::initialize_eb2_structs()
                 cnt++;
               }
             }
-          }
-        });
+          });
 
 #if defined(AMREX_USE_CUDA) || defined(AMREX_USE_HIP)
         const int v_all_cut_faces_size = v_all_cut_faces.size();
@@ -318,6 +368,65 @@ PeleC::initialize_eb2_structs()
       }
     }
   }
+
+  // Stencils of old boxes that were not reused are freed here
+  level_cache.clear();
+
+  if (verbose > 0) {
+    int n_cut_boxes = 0;
+    int n_cached_boxes = 0;
+    for (amrex::MFIter mfi(vfrac, false); mfi.isValid(); ++mfi) {
+      if (
+        flags[mfi].getType(mfi.growntilebox()) ==
+        amrex::FabType::singlevalued) {
+        n_cut_boxes++;
+        n_cached_boxes += from_cache[mfi.LocalIndex()];
+      }
+    }
+    const int IOProc = amrex::ParallelDescriptor::IOProcessorNumber();
+    amrex::Real run_time = amrex::ParallelDescriptor::second() - strt_time;
+    amrex::ParallelDescriptor::ReduceRealMax(run_time, IOProc);
+    amrex::ParallelDescriptor::ReduceIntSum(n_cut_boxes, IOProc);
+    amrex::ParallelDescriptor::ReduceIntSum(n_cached_boxes, IOProc);
+    amrex::Print() << "PeleC::initialize_eb2_structs() time = " << run_time
+                   << " (stencils reused for " << n_cached_boxes << " of "
+                   << n_cut_boxes << " cut boxes)\n";
+  }
+}
+
+// Move the EB stencils of the level this one replaces into a map keyed by
+// the grown box. During a regrid the new level is built while the old one is
+// still registered with Amr; the old level is deleted right after, and it
+// does not use its stencils in between.
+void
+PeleC::take_eb_stencils_of_old_level(
+  std::map<amrex::Box, EBStencilCacheEntry>& stencils)
+{
+  auto& amr_levels = parent->getAmrLevels();
+  if (
+    (level >= static_cast<int>(amr_levels.size())) ||
+    (amr_levels[level] == nullptr) || (amr_levels[level].get() == this)) {
+    return;
+  }
+
+  auto* oldlev = (PeleC*)amr_levels[level].get();
+  if (oldlev->sv_eb_bndry_geom.size() != oldlev->vfrac.local_size()) {
+    return;
+  }
+  for (amrex::MFIter mfi(oldlev->vfrac, false); mfi.isValid(); ++mfi) {
+    const int iLocal = mfi.LocalIndex();
+    if (oldlev->sv_eb_bndry_geom[iLocal].empty()) {
+      continue;
+    }
+    auto& entry = stencils[mfi.growntilebox()];
+    entry.bndry_geom = std::move(oldlev->sv_eb_bndry_geom[iLocal]);
+    entry.bndry_grad_stencil =
+      std::move(oldlev->sv_eb_bndry_grad_stencil[iLocal]);
+    for (int dir = 0; dir < AMREX_SPACEDIM; ++dir) {
+      entry.flux_interp_stencil[dir] =
+        std::move(oldlev->flux_interp_stencil[dir][iLocal]);
+    }
+  }
 }
 
 void
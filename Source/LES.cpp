@@ -169,8 +169,17 @@ PeleC::getSmagorinskyLESTerm(
     {AMREX_D_DECL(dx1, dx1, dx1)}};
   const amrex::Real* dxDp = dxD.data();
 
-  amrex::MultiFab S(grids, dmap, NVAR, ngrow, amrex::MFInfo(), Factory());
-  FillPatch(*this, S, ngrow, time, State_Type, 0, NVAR);
+  // Reuse the primitive state of Sborder if it was filled at this time,
+  // otherwise fill patch a local copy of the state
+  const bool use_prim_cache = primitive_cache_matches(time, ngrow);
+  amrex::MultiFab S_fp;
+  if (use_prim_cache) {
+    build_primitive_cache(Sborder, ngrow, false);
+  } else {
+    S_fp.define(grids, dmap, NVAR, ngrow, amrex::MFInfo(), Factory());
+    FillPatch(*this, S_fp, ngrow, time, State_Type, 0, NVAR);
+  }
+  const amrex::MultiFab& S = use_prim_cache ? Sborder : S_fp;
 
   // Fetch some gpu arrays
   prefetchToDevice(S);
@@ -198,21 +207,26 @@ PeleC::getSmagorinskyLESTerm(
         continue;
       }
 
-      auto const& s = S.array(mfi);
-      int nqaux = NQAUX > 0 ? NQAUX : 1;
-      amrex::FArrayBox q(gbox, QVAR, amrex::The_Async_Arena());
-      amrex::FArrayBox qaux(gbox, nqaux, amrex::The_Async_Arena());
-      auto const& q_ar = q.array();
-      auto const& qauxar = qaux.array();
-
       // Get primitives, Q, including (Y, T, p, rho) from conserved state
       // required for L term
-      {
+      amrex::FArrayBox q;
+      amrex::FArrayBox qaux;
+      amrex::Array4<const amrex::Real> q_ar;
+      if (use_prim_cache) {
+        q_ar = prim_q.const_array(mfi);
+      } else {
+        auto const& s = S.array(mfi);
+        int nqaux = NQAUX > 0 ? NQAUX : 1;
+        q.resize(gbox, QVAR, amrex::The_Async_Arena());
+        qaux.resize(gbox, nqaux, amrex::The_Async_Arena());
+        auto const& qarr = q.array();
+        auto const& qauxar = qaux.array();
         BL_PROFILE("PeleC::ctoprim()");
         amrex::ParallelFor(
           gbox, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
-            pc_ctoprim(i, j, k, s, q_ar, qauxar);
+            pc_ctoprim(i, j, k, s, qarr, qauxar);
           });
+        q_ar = qarr;
       }
 
       // Get the tangential derivatives
@@ -346,13 +360,23 @@ PeleC::getDynamicSmagorinskyLESTerm(
 
   */
   // clang-format on
-  Filter test_filter = Filter(les_test_filter_type, les_test_filter_fgr);
-  Filter coeff_filter = Filter(box, 6);
+  Filter& test_filter = les_test_filter;
+  Filter& coeff_filter = les_coeff_filter;
 
   const int nGrowD = 1;
   const int nGrowC = coeff_filter.get_filter_ngrow();
   const int nGrowT = test_filter.get_filter_ngrow();
 
+  // The coefficients are recomputed every les_dynamic_interval level steps
+  // (at the first call of the step), or at every call if it is not positive.
+  // In between only K, RUT, ... are needed, on g4box.
+  const int nstep = parent->levelSteps(level);
+  const bool update_coeffs =
+    (les_dynamic_interval <= 0) || (les_coeffs_step < 0) ||
+    (nstep - les_coeffs_step >= les_dynamic_interval);
+  const int nGrowQ = update_coeffs ? nGrowC + nGrowT + 1 : 1;
+  const int nGrowS = nGrowD + nGrowQ;
+
   const amrex::GpuArray<amrex::Real, AMREX_SPACEDIM> dx = geom.CellSizeArray();
   amrex::Real dx1 = dx[0];
   for (int dir = 1; dir < AMREX_SPACEDIM; ++dir) {
@@ -362,12 +386,28 @@ PeleC::getDynamicSmagorinskyLESTerm(
     {AMREX_D_DECL(dx1, dx1, dx1)}};
   const amrex::Real* dxDp = dxD.data();
 
-  // 1. Get state variable data
-  amrex::MultiFab S(
-    grids, dmap, NVAR, nGrowD + nGrowC + nGrowT + 1, amrex::MFInfo(),
-    Factory());
-  FillPatch(*this, S, nGrowD + nGrowC + nGrowT + 1, time, State_Type, 0, NVAR);
-  LES_Coeffs.setVal(0.0);
+  // 1. Get state variable data. Reuse Sborder and its primitive state if it
+  // was filled at this time with enough grow cells, otherwise fill patch the
+  // persistent buffer
+  const bool use_prim_cache = primitive_cache_matches(time, nGrowS);
+  if (use_prim_cache) {
+    build_primitive_cache(Sborder, nGrowS, false);
+  } else {
+    if (
+      les_state.empty() || (les_state.boxArray() != grids) ||
+      (les_state.DistributionMap() != dmap) ||
+      (les_state.nGrow() < nGrowS)) {
+      les_state.define(
+        grids, dmap, NVAR, nGrowD + nGrowC + nGrowT + 1, amrex::MFInfo(),
+        Factory());
+    }
+    FillPatch(*this, les_state, nGrowS, time, State_Type, 0, NVAR);
+  }
+  const amrex::MultiFab& S = use_prim_cache ? Sborder : les_state;
+  if (update_coeffs) {
+    LES_Coeffs.setVal(0.0);
+    les_coeffs_step = nstep;
+  }
 
   // Fetch some gpu arrays
   prefetchToDevice(S);
@@ -384,8 +424,8 @@ PeleC::getDynamicSmagorinskyLESTerm(
   {
     for (amrex::MFIter mfi(S, amrex::TilingIfNotGPU()); mfi.isValid(); ++mfi) {
       const amrex::Box vbox = mfi.tilebox();
-      const amrex::Box g0box = amrex::grow(vbox, nGrowD + nGrowC + nGrowT + 1);
-      const amrex::Box g1box = amrex::grow(vbox, nGrowC + nGrowT + 1);
+      const amrex::Box g0box = amrex::grow(vbox, nGrowS);
+      const amrex::Box g1box = amrex::grow(vbox, nGrowQ);
       const amrex::Box g2box = amrex::grow(vbox, nGrowD + nGrowC + 1);
       const amrex::Box g3box = amrex::grow(vbox, nGrowC + 1);
       const amrex::Box g4box = amrex::grow(vbox, 1);
@@ -400,21 +440,26 @@ PeleC::getDynamicSmagorinskyLESTerm(
         continue;
       }
 
-      auto const& s = S.array(mfi);
-      int nqaux = NQAUX > 0 ? NQAUX : 1;
-      amrex::FArrayBox q(g0box, QVAR, amrex::The_Async_Arena());
-      amrex::FArrayBox qaux(g0box, nqaux, amrex::The_Async_Arena());
-      auto const& q_ar = q.array();
-      auto const& qauxar = qaux.array();
-
       // 1. Get primitives, Q, including (Y, T, p, rho) from conserved state
       // required for L term
-      {
+      amrex::FArrayBox q;
+      amrex::FArrayBox qaux;
+      amrex::Array4<const amrex::Real> q_ar;
+      if (use_prim_cache) {
+        q_ar = prim_q.const_array(mfi);
+      } else {
+        auto const& s = S.array(mfi);
+        int nqaux = NQAUX > 0 ? NQAUX : 1;
+        q.resize(g0box, QVAR, amrex::The_Async_Arena());
+        qaux.resize(g0box, nqaux, amrex::The_Async_Arena());
+        auto const& qarr = q.array();
+        auto const& qauxar = qaux.array();
         BL_PROFILE("PeleC::ctoprim()");
         amrex::ParallelFor(
           g0box, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
-            pc_ctoprim(i, j, k, s, q_ar, qauxar);
+            pc_ctoprim(i, j, k, s, qarr, qauxar);
           });
+        q_ar = qarr;
       }
 
       // 2. Get dynamic Smagorinsky derived quantities after setting the
@@ -445,67 +490,70 @@ PeleC::getDynamicSmagorinskyLESTerm(
           });
       }
 
-      // 3. Filter the state variables and the derived quantities at the
-      // test filter level - still at cell centers
-      amrex::FArrayBox filtered_S(g2box, NVAR, amrex::The_Async_Arena());
-      amrex::FArrayBox filtered_Q(g2box, QVAR, amrex::The_Async_Arena());
-      amrex::FArrayBox filtered_Qaux(
-        g2box, NQAUX > 0 ? NQAUX : 1, amrex::The_Async_Arena());
-      amrex::FArrayBox filtered_K(
-        g3box, upper_triangle_n, amrex::The_Async_Arena());
-      amrex::FArrayBox filtered_RUT(
-        g3box, AMREX_SPACEDIM, amrex::The_Async_Arena());
-      amrex::FArrayBox filtered_alphaij(
-        g3box, AMREX_SPACEDIM * AMREX_SPACEDIM, amrex::The_Async_Arena());
-      amrex::FArrayBox filtered_alpha(g3box, 1, amrex::The_Async_Arena());
-      amrex::FArrayBox filtered_flux_T(
-        g3box, AMREX_SPACEDIM, amrex::The_Async_Arena());
-
-      auto const& filtered_S_ar = filtered_S.array();
-      auto const& filtered_Q_ar = filtered_Q.array();
-      auto const& filtered_Qaux_ar = filtered_Qaux.array();
-
-      const amrex::FArrayBox& Sfab = S[mfi];
-      test_filter.apply_filter(g2box, Sfab, filtered_S);
-      {
-        BL_PROFILE("PeleC::ctoprim()");
-        amrex::ParallelFor(
-          g2box, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
-            pc_ctoprim(i, j, k, filtered_S_ar, filtered_Q_ar, filtered_Qaux_ar);
-          });
-      }
-      test_filter.apply_filter(g3box, K, filtered_K);
-      test_filter.apply_filter(g3box, RUT, filtered_RUT);
-      test_filter.apply_filter(g3box, alphaij, filtered_alphaij);
-      test_filter.apply_filter(g3box, alpha, filtered_alpha);
-      test_filter.apply_filter(g3box, flux_T, filtered_flux_T);
-
-      // 4. Calculate the dynamic Smagorinsky coefficients - still at cell
-      // centers
-      int do_harmonic = 1;
-      amrex::FArrayBox coeff_cc(g3box, nCompC, amrex::The_Async_Arena());
-      auto const& coeff_cc_ar = coeff_cc.array();
-      auto const& filtered_K_ar = filtered_K.array();
-      auto const& filtered_RUT_ar = filtered_RUT.array();
-      auto const& filtered_alphaij_ar = filtered_alphaij.array();
-      auto const& filtered_alpha_ar = filtered_alpha.array();
-      auto const& filtered_flux_T_ar = filtered_flux_T.array();
-      {
-        const int les_test_filter_fgr_local = PeleC::les_test_filter_fgr;
-        BL_PROFILE("PeleC::pc_dynamic_smagorinsky_coeffs()");
-        amrex::ParallelFor(
-          g3box, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
-            pc_dynamic_smagorinsky_coeffs(
-              i, j, k, filtered_Q_ar, les_test_filter_fgr_local, dx,
-              filtered_K_ar, filtered_RUT_ar, filtered_alphaij_ar,
-              filtered_alpha_ar, filtered_flux_T_ar, coeff_cc_ar);
-          });
-      }
+      if (update_coeffs) {
+        // 3. Filter the state variables and the derived quantities at the
+        // test filter level - still at cell centers
+        amrex::FArrayBox filtered_S(g2box, NVAR, amrex::The_Async_Arena());
+        amrex::FArrayBox filtered_Q(g2box, QVAR, amrex::The_Async_Arena());
+        amrex::FArrayBox filtered_Qaux(
+          g2box, NQAUX > 0 ? NQAUX : 1, amrex::The_Async_Arena());
+        amrex::FArrayBox filtered_K(
+          g3box, upper_triangle_n, amrex::The_Async_Arena());
+        amrex::FArrayBox filtered_RUT(
+          g3box, AMREX_SPACEDIM, amrex::The_Async_Arena());
+        amrex::FArrayBox filtered_alphaij(
+          g3box, AMREX_SPACEDIM * AMREX_SPACEDIM, amrex::The_Async_Arena());
+        amrex::FArrayBox filtered_alpha(g3box, 1, amrex::The_Async_Arena());
+        amrex::FArrayBox filtered_flux_T(
+          g3box, AMREX_SPACEDIM, amrex::The_Async_Arena());
+
+        auto const& filtered_S_ar = filtered_S.array();
+        auto const& filtered_Q_ar = filtered_Q.array();
+        auto const& filtered_Qaux_ar = filtered_Qaux.array();
+
+        const amrex::FArrayBox& Sfab = S[mfi];
+        test_filter.apply_filter(g2box, Sfab, filtered_S);
+        {
+          BL_PROFILE("PeleC::ctoprim()");
+          amrex::ParallelFor(
+            g2box, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
+              pc_ctoprim(
+                i, j, k, filtered_S_ar, filtered_Q_ar, filtered_Qaux_ar);
+            });
+        }
+        test_filter.apply_filter(g3box, K, filtered_K);
+        test_filter.apply_filter(g3box, RUT, filtered_RUT);
+        test_filter.apply_filter(g3box, alphaij, filtered_alphaij);
+        test_filter.apply_filter(g3box, alpha, filtered_alpha);
+        test_filter.apply_filter(g3box, flux_T, filtered_flux_T);
+
+        // 4. Calculate the dynamic Smagorinsky coefficients - still at cell
+        // centers
+        amrex::FArrayBox coeff_cc(g3box, nCompC, amrex::The_Async_Arena());
+        auto const& coeff_cc_ar = coeff_cc.array();
+        auto const& filtered_K_ar = filtered_K.array();
+        auto const& filtered_RUT_ar = filtered_RUT.array();
+        auto const& filtered_alphaij_ar = filtered_alphaij.array();
+        auto const& filtered_alpha_ar = filtered_alpha.array();
+        auto const& filtered_flux_T_ar = filtered_flux_T.array();
+        {
+          const int les_test_filter_fgr_local = PeleC::les_test_filter_fgr;
+          BL_PROFILE("PeleC::pc_dynamic_smagorinsky_coeffs()");
+          amrex::ParallelFor(
+            g3box, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
+              pc_dynamic_smagorinsky_coeffs(
+                i, j, k, filtered_Q_ar, les_test_filter_fgr_local, dx,
+                filtered_K_ar, filtered_RUT_ar, filtered_alphaij_ar,
+                filtered_alpha_ar, filtered_flux_T_ar, coeff_cc_ar);
+            });
+        }
 
-      // 5. Filter to smooth the dynamic coefficients - still at cell
-      // centers
+        // 5. Filter to smooth the dynamic coefficients - still at cell
+        // centers
+        coeff_filter.apply_filter(g4box, coeff_cc, LES_Coeffs[mfi]);
+      }
       auto const& LES_Coeffs_ar = LES_Coeffs[mfi].array();
-      coeff_filter.apply_filter(g4box, coeff_cc, LES_Coeffs[mfi]);
+      int do_harmonic = 1;
 
       // 6. Get the SFS term
 
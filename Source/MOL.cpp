@@ -13,6 +13,7 @@ pc_compute_hyp_mol_flux(
   /*unused*/,
   const int plm_iorder,
   const bool use_laxf_flux,
+  const amrex::Real gamma_cache_tol,
   const amrex::Array4<amrex::EBCellFlag const>& flags,
   const EBBndryGeom* ebg,
   const int /*Nebg*/,
@@ -26,12 +27,25 @@ pc_compute_hyp_mol_flux(
   const int R_P = 4;
   const int R_ADV = 5;
   const int R_Y = R_ADV + NUM_ADV;
+#if NUM_AUX > 0
+  const int R_AUX = R_Y + NUM_SPECIES;
+#endif
+#if NUM_LIN > 0
+  const int R_LIN = R_Y + NUM_SPECIES + NUM_AUX;
+#endif
   const int R_NUM = 5 + NUM_SPECIES + NUM_ADV + NUM_LIN + NUM_AUX;
   const int bc_test_val = 1;
 
+  // Slopes, and the left/right states reconstructed on the faces normal to
+  // the current direction. The face states are staged component by component
+  // so the reconstruction and the Riemann solve run as two separate sweeps
+  // over the faces, without carrying R_NUM-sized arrays through both.
+  amrex::FArrayBox dq_fab(cbox, QVAR, amrex::The_Async_Arena());
+  auto const& dq = dq_fab.array();
+  amrex::FArrayBox qfl_fab;
+  amrex::FArrayBox qfr_fab;
+
   for (int dir = 0; dir < AMREX_SPACEDIM; dir++) {
-    amrex::FArrayBox dq_fab(cbox, QVAR, amrex::The_Async_Arena());
-    auto const& dq = dq_fab.array();
     setV(cbox, QVAR, dq, 0.0);
 
     // dimensional indexing
@@ -55,83 +69,95 @@ pc_compute_hyp_mol_flux(
     }
     const amrex::Box tbox = amrex::grow(cbox, dir, -1);
     const amrex::Box ebox = amrex::surroundingNodes(tbox, dir);
+    qfl_fab.resize(ebox, R_NUM, amrex::The_Async_Arena());
+    qfr_fab.resize(ebox, R_NUM, amrex::The_Async_Arena());
+    auto const& ql = qfl_fab.array();
+    auto const& qr = qfr_fab.array();
+
+    // Reconstruct the face states
     amrex::ParallelFor(
       ebox, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
         const amrex::IntVect iv{AMREX_D_DECL(i, j, k)};
         const amrex::IntVect ivm(iv - amrex::IntVect::TheDimensionVector(dir));
 
-        amrex::Real qtempl[R_NUM] = {0.0};
-        qtempl[R_UN] =
+        ql(iv, R_UN) =
           q(ivm, q_idx[0]) + 0.5 * ((dq(ivm, 1) - dq(ivm, 0)) / q(ivm, QRHO));
-        qtempl[R_P] =
+        ql(iv, R_P) =
           q(ivm, QPRES) + 0.5 * (dq(ivm, 0) + dq(ivm, 1)) * qaux(ivm, QC);
-        qtempl[R_UT1] = q(ivm, q_idx[1]) + 0.5 * dq(ivm, 2);
-        qtempl[R_UT2] =
+        ql(iv, R_UT1) = q(ivm, q_idx[1]) + 0.5 * dq(ivm, 2);
+        ql(iv, R_UT2) =
           AMREX_D_PICK(0.0, 0.0, q(ivm, q_idx[2]) + 0.5 * dq(ivm, 3));
-        qtempl[R_RHO] = 0.0;
+        amrex::Real rhol = 0.0;
         for (int n = 0; n < NUM_SPECIES; n++) {
-          qtempl[R_Y + n] =
+          const amrex::Real rhoYl =
             q(ivm, QFS + n) * q(ivm, QRHO) +
             0.5 * (dq(ivm, QFS + n) +
                    q(ivm, QFS + n) * (dq(ivm, 0) + dq(ivm, 1)) / qaux(ivm, QC));
-          qtempl[R_RHO] += qtempl[R_Y + n];
+          ql(iv, R_Y + n) = rhoYl;
+          rhol += rhoYl;
         }
-
+        ql(iv, R_RHO) = rhol;
         for (int n = 0; n < NUM_SPECIES; n++) {
-          qtempl[R_Y + n] = qtempl[R_Y + n] / qtempl[R_RHO];
+          ql(iv, R_Y + n) = ql(iv, R_Y + n) / rhol;
         }
 
-        amrex::Real qtempr[R_NUM] = {0.0};
-        qtempr[R_UN] =
+        qr(iv, R_UN) =
           q(iv, q_idx[0]) - 0.5 * ((dq(iv, 1) - dq(iv, 0)) / q(iv, QRHO));
-        qtempr[R_P] =
+        qr(iv, R_P) =
           q(iv, QPRES) - 0.5 * (dq(iv, 0) + dq(iv, 1)) * qaux(iv, QC);
-        qtempr[R_UT1] = q(iv, q_idx[1]) - 0.5 * dq(iv, 2);
-        qtempr[R_UT2] =
+        qr(iv, R_UT1) = q(iv, q_idx[1]) - 0.5 * dq(iv, 2);
+        qr(iv, R_UT2) =
           AMREX_D_PICK(0.0, 0.0, q(iv, q_idx[2]) - 0.5 * dq(iv, 3));
-        qtempr[R_RHO] = 0.0;
+        amrex::Real rhor = 0.0;
         for (int n = 0; n < NUM_SPECIES; n++) {
-          qtempr[R_Y + n] =
+          const amrex::Real rhoYr =
             q(iv, QFS + n) * q(iv, QRHO) -
             0.5 * (dq(iv, QFS + n) +
                    q(iv, QFS + n) * (dq(iv, 0) + dq(iv, 1)) / qaux(iv, QC));
-          qtempr[R_RHO] += qtempr[R_Y + n];
+          qr(iv, R_Y + n) = rhoYr;
+          rhor += rhoYr;
         }
+        qr(iv, R_RHO) = rhor;
         for (int n = 0; n < NUM_SPECIES; n++) {
-          qtempr[R_Y + n] = qtempr[R_Y + n] / qtempr[R_RHO];
+          qr(iv, R_Y + n) = qr(iv, R_Y + n) / rhor;
         }
 
 #if NUM_ADV > 0
         for (int n = 0; n < NUM_ADV; n++) {
-          qtempl[R_ADV + n] = q(ivm, QFA + n) + 0.5 * dq(ivm, QFA + n);
-          qtempr[R_ADV + n] = q(iv, QFA + n) - 0.5 * dq(iv, QFA + n);
+          ql(iv, R_ADV + n) = q(ivm, QFA + n) + 0.5 * dq(ivm, QFA + n);
+          qr(iv, R_ADV + n) = q(iv, QFA + n) - 0.5 * dq(iv, QFA + n);
         }
 #endif
 #if NUM_AUX > 0
-        const int R_AUX = R_Y + NUM_SPECIES;
         for (int n = 0; n < NUM_AUX; n++) {
-          qtempl[R_AUX + n] = q(ivm, QFX + n) + 0.5 * dq(ivm, QFX + n);
-          qtempr[R_AUX + n] = q(iv, QFX + n) - 0.5 * dq(iv, QFX + n);
+          ql(iv, R_AUX + n) = q(ivm, QFX + n) + 0.5 * dq(ivm, QFX + n);
+          qr(iv, R_AUX + n) = q(iv, QFX + n) - 0.5 * dq(iv, QFX + n);
         }
 #endif
 #if NUM_LIN > 0
-        const int R_LIN = R_Y + NUM_SPECIES + NUM_AUX;
         for (int n = 0; n < NUM_LIN; n++) {
-          qtempl[R_LIN + n] = q(ivm, QLIN + n) + 0.5 * dq(ivm, QLIN + n);
-          qtempr[R_LIN + n] = q(iv, QLIN + n) - 0.5 * dq(iv, QLIN + n);
+          ql(iv, R_LIN + n) = q(ivm, QLIN + n) + 0.5 * dq(ivm, QLIN + n);
+          qr(iv, R_LIN + n) = q(iv, QLIN + n) - 0.5 * dq(iv, QLIN + n);
         }
 #endif
+      });
+
+    // Riemann solve on the faces
+    amrex::ParallelFor(
+      ebox, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
+        const amrex::IntVect iv{AMREX_D_DECL(i, j, k)};
+        const amrex::IntVect ivm(iv - amrex::IntVect::TheDimensionVector(dir));
 
         const amrex::Real cavg = 0.5 * (qaux(iv, QC) + qaux(ivm, QC));
 
         amrex::Real spl[NUM_SPECIES];
         for (int n = 0; n < NUM_SPECIES; n++) {
-          spl[n] = qtempl[R_Y + n];
+          spl[n] = ql(iv, R_Y + n);
         }
 
         amrex::Real spr[NUM_SPECIES];
         for (int n = 0; n < NUM_SPECIES; n++) {
-          spr[n] = qtempr[R_Y + n];
+          spr[n] = qr(iv, R_Y + n);
         }
 
         amrex::Real flux_tmp[NVAR] = {0.0};
@@ -140,64 +166,68 @@ pc_compute_hyp_mol_flux(
         if (!use_laxf_flux) {
           amrex::Real qint_iu = 0.0, tmp1 = 0.0, tmp2 = 0.0, tmp3 = 0.0,
                       tmp4 = 0.0;
+          const amrex::Real gamcl = pc_cached_gamma(
+            qaux(ivm, QGAMC), qaux(iv, QGAMC), gamma_cache_tol);
+          const amrex::Real gamcr = pc_cached_gamma(
+            qaux(iv, QGAMC), qaux(ivm, QGAMC), gamma_cache_tol);
           riemann(
-            qtempl[R_RHO], qtempl[R_UN], qtempl[R_UT1], qtempl[R_UT2],
-            qtempl[R_P], spl, qtempr[R_RHO], qtempr[R_UN], qtempr[R_UT1],
-            qtempr[R_UT2], qtempr[R_P], spr, bc_test_val, cavg, ustar,
+            ql(iv, R_RHO), ql(iv, R_UN), ql(iv, R_UT1), ql(iv, R_UT2),
+            ql(iv, R_P), spl, qr(iv, R_RHO), qr(iv, R_UN), qr(iv, R_UT1),
+            qr(iv, R_UT2), qr(iv, R_P), spr, bc_test_val, cavg, ustar,
             flux_tmp[URHO], &flux_tmp[UFS], flux_tmp[f_idx[0]],
             flux_tmp[f_idx[1]], flux_tmp[f_idx[2]], flux_tmp[UEDEN],
-            flux_tmp[UEINT], qint_iu, tmp1, tmp2, tmp3, tmp4);
+            flux_tmp[UEINT], qint_iu, tmp1, tmp2, tmp3, tmp4, gamcl, gamcr);
 #if NUM_ADV > 0
           for (int n = 0; n < NUM_ADV; n++) {
             pc_cmpflx_passive(
-              ustar, flux_tmp[URHO], qtempl[R_ADV + n], qtempr[R_ADV + n],
+              ustar, flux_tmp[URHO], ql(iv, R_ADV + n), qr(iv, R_ADV + n),
               flux_tmp[UFA + n]);
           }
 #endif
 #if NUM_AUX > 0
           for (int n = 0; n < NUM_AUX; n++) {
             pc_cmpflx_passive(
-              ustar, flux_tmp[URHO], qtempl[R_AUX + n], qtempr[R_AUX + n],
+              ustar, flux_tmp[URHO], ql(iv, R_AUX + n), qr(iv, R_AUX + n),
               flux_tmp[UFX + n]);
           }
 #endif
 #if NUM_LIN > 0
           for (int n = 0; n < NUM_LIN; n++) {
             pc_cmpflx_passive(
-              ustar, qint_iu, qtempl[R_LIN + n], qtempr[R_LIN + n],
+              ustar, qint_iu, ql(iv, R_LIN + n), qr(iv, R_LIN + n),
               flux_tmp[ULIN + n]);
           }
 #endif
         } else {
           amrex::Real maxeigval = 0.0;
           laxfriedrich_flux(
-            qtempl[R_RHO], qtempl[R_UN], qtempl[R_UT1], qtempl[R_UT2],
-            qtempl[R_P], spl, qtempr[R_RHO], qtempr[R_UN], qtempr[R_UT1],
-            qtempr[R_UT2], qtempr[R_P], spr, bc_test_val, cavg, ustar,
+            ql(iv, R_RHO), ql(iv, R_UN), ql(iv, R_UT1), ql(iv, R_UT2),
+            ql(iv, R_P), spl, qr(iv, R_RHO), qr(iv, R_UN), qr(iv, R_UT1),
+            qr(iv, R_UT2), qr(iv, R_P), spr, bc_test_val, cavg, ustar,
             maxeigval, flux_tmp[URHO], &flux_tmp[UFS], flux_tmp[f_idx[0]],
             flux_tmp[f_idx[1]], flux_tmp[f_idx[2]], flux_tmp[UEDEN],
             flux_tmp[UEINT]);
 #if NUM_ADV > 0
           for (int n = 0; n < NUM_ADV; n++) {
             pc_lax_cmpflx_passive(
-              qtempl[R_UN], qtempr[R_UN], qtempl[R_RHO], qtempr[R_RHO],
-              qtempl[R_ADV + n], qtempr[R_ADV + n], maxeigval,
+              ql(iv, R_UN), qr(iv, R_UN), ql(iv, R_RHO), qr(iv, R_RHO),
+              ql(iv, R_ADV + n), qr(iv, R_ADV + n), maxeigval,
               flux_tmp[UFA + n]);
           }
 #endif
 #if NUM_AUX > 0
           for (int n = 0; n < NUM_AUX; n++) {
             pc_lax_cmpflx_passive(
-              qtempl[R_UN], qtempr[R_UN], qtempl[R_RHO], qtempr[R_RHO],
-              qtempl[R_AUX + n], qtempr[R_AUX + n], maxeigval,
+              ql(iv, R_UN), qr(iv, R_UN), ql(iv, R_RHO), qr(iv, R_RHO),
+              ql(iv, R_AUX + n), qr(iv, R_AUX + n), maxeigval,
               flux_tmp[UFX + n]);
           }
 #endif
 #if NUM_LIN > 0
           for (int n = 0; n < NUM_LIN; n++) {
             pc_lax_cmpflx_passive(
-              qtempl[R_UN], qtempr[R_UN], 1., 1., qtempl[R_LIN + n],
-              qtempr[R_LIN + n], maxeigval, flux_tmp[ULIN + n]);
+              ql(iv, R_UN), qr(iv, R_UN), 1., 1., ql(iv, R_LIN + n),
+              qr(iv, R_LIN + n), maxeigval, flux_tmp[ULIN + n]);
           }
 #endif
         }
@@ -30,6 +30,7 @@ using namespace MASA;
 #include "Timestep.H"
 #include "Utilities.H"
 #include "Tagging.H"
+#include "FusedTagging.H"
 #include "IndexDefines.H"
 
 #ifdef PELEC_ENABLE_FPE_TRAP
@@ -85,6 +86,7 @@ int PeleC::les_filter_type = no_filter;
 int PeleC::les_filter_fgr = 1;
 int PeleC::les_test_filter_type = box_3pt_optimized_approx;
 int PeleC::les_test_filter_fgr = 2;
+int PeleC::les_dynamic_interval = 0;
 
 bool PeleC::eb_in_domain = false;
 bool PeleC::eb_initialized = false;
@@ -102,6 +104,10 @@ pele::physics::transport::TransportParams<
   PeleC::trans_parms;
 
 pele::physics::turbinflow::TurbInflow PeleC::turb_inflow;
+BndryPlaneCache PeleC::turb_inflow_planes;
+BndryPlaneCache PeleC::prob_inflow_planes;
+bool PeleC::time_bcfill_hyp = false;
+amrex::Real PeleC::bcfill_hyp_time = 0.0;
 
 amrex::Vector<int> PeleC::src_list;
 
@@ -295,6 +301,11 @@ PeleC::read_params()
     amrex::Print() << "WARNING -- CFL should be <= 0.3 when using MOL hydro."
                    << std::endl;
   }
+  if (!do_mol && (sdc_tol > 0.0) && (sdc_iters <= 2)) {
+    amrex::Print() << "WARNING -- pelec.sdc_tol is ignored unless "
+                      "pelec.sdc_iters > 2."
+                   << std::endl;
+  }
 
   if ((do_les || use_explicit_filter) && (AMREX_SPACEDIM != 3)) {
     amrex::Abort("Using LES/filtering currently requires 3d.");
@@ -304,6 +315,7 @@ PeleC::read_params()
     pp.query("les_model", les_model);
     pp.query("les_test_filter_type", les_test_filter_type);
     pp.query("les_test_filter_fgr", les_test_filter_fgr);
+    pp.query("les_dynamic_interval", les_dynamic_interval);
   }
 
   if (use_explicit_filter) {
@@ -632,6 +644,12 @@ PeleC::initData()
 {
   BL_PROFILE("PeleC::initData()");
 
+  // Problem setup that depends on this level's grids, before the problem
+  // parameters are copied to the device
+  if (init_pltfile.empty()) {
+    problem_pre_initdata();
+  }
+
   // Copy problem parameter structs to device
   amrex::Gpu::copy(
     amrex::Gpu::hostToDevice, PeleC::h_prob_parm_device,
@@ -791,20 +809,9 @@ PeleC::estTimeStep(amrex::Real /*dt_old*/)
 
   const amrex::MultiFab& stateMF = get_new_data(State_Type);
 
-  const amrex::Real* dx = geom.CellSize();
-
   std::string limiter = "pelec.max_dt";
 
-  // Start the hydro with the max_dt value, but divide by CFL
-  // to account for the fact that we multiply by it at the end.
-  // This ensures that if max_dt is more restrictive than the hydro
-  // criterion, we will get exactly max_dt for a timestep.
-
   const amrex::Real max_dt_over_cfl = max_dt / cfl;
-  amrex::Real estdt_hydro = max_dt_over_cfl;
-  amrex::Real estdt_vdif = max_dt_over_cfl;
-  amrex::Real estdt_tdif = max_dt_over_cfl;
-  amrex::Real estdt_edif = max_dt_over_cfl;
   if (do_hydro || do_mol || diffuse_vel || diffuse_temp || diffuse_enth) {
 
     auto const& fact =
@@ -812,80 +819,95 @@ PeleC::estTimeStep(amrex::Real /*dt_old*/)
     auto const& flags = fact.getMultiEBCellFlagFab();
 
     prefetchToDevice(stateMF); // This should accelerate the below operations.
-    amrex::Real AMREX_D_DECL(dx1 = dx[0], dx2 = dx[1], dx3 = dx[2]);
+    const amrex::GpuArray<amrex::Real, AMREX_SPACEDIM> dxa =
+      geom.CellSizeArray();
+    auto const* ltransparm = trans_parms.device_trans_parm();
+    const bool l_do_hydro = do_hydro;
+    const bool l_diffuse_vel = diffuse_vel;
+    const bool l_diffuse_temp = diffuse_temp;
+    const bool l_diffuse_enth = diffuse_enth;
+
+    // The transport coefficients are evaluated here from the new state. The
+    // coefficients cached by the last diffusion evaluation are never those of
+    // the new state (every fill of Sborder invalidates them), so they are
+    // only reused when lagged coefficients are allowed.
+    const bool use_coef =
+      estdt_lagged_coeffs && (diffuse_vel || diffuse_temp || diffuse_enth) &&
+      prim_coeff_valid && (prim_state == &Sborder) &&
+      (prim_coeff.boxArray() == grids) &&
+      (prim_coeff.DistributionMap() == dmap);
+
+    // All the limits in one pass over the state
+    amrex::ReduceOps<
+      amrex::ReduceOpMin, amrex::ReduceOpMin, amrex::ReduceOpMin,
+      amrex::ReduceOpMin>
+      reduce_op;
+    amrex::ReduceData<amrex::Real, amrex::Real, amrex::Real, amrex::Real>
+      reduce_data(reduce_op);
+    using ReduceTuple = typename decltype(reduce_data)::Type;
 
-    if (do_hydro) {
-      amrex::Real dt = amrex::ReduceMin(
-        stateMF, flags, 0,
-        [=] AMREX_GPU_HOST_DEVICE(
-          amrex::Box const& bx, const amrex::Array4<const amrex::Real>& fab_arr,
-          const amrex::Array4<const amrex::EBCellFlag>& flag_arr)
-          -> amrex::Real {
-          return pc_estdt_hydro(
-            bx, fab_arr, flag_arr, AMREX_D_DECL(dx1, dx2, dx3));
-        });
-      estdt_hydro = amrex::min<amrex::Real>(estdt_hydro, dt);
-    }
-
-    if (diffuse_vel) {
-      auto const* ltransparm = trans_parms.device_trans_parm();
-      amrex::Real dt = amrex::ReduceMin(
-        stateMF, flags, 0,
-        [=] AMREX_GPU_HOST_DEVICE(
-          amrex::Box const& bx, const amrex::Array4<const amrex::Real>& fab_arr,
-          const amrex::Array4<const amrex::EBCellFlag>& flag_arr)
-          -> amrex::Real {
-          return pc_estdt_veldif(
-            bx, fab_arr, flag_arr, AMREX_D_DECL(dx1, dx2, dx3), ltransparm);
-        });
-      estdt_vdif = amrex::min<amrex::Real>(estdt_vdif, dt);
-    }
-
-    if (diffuse_temp) {
-      auto const* ltransparm = trans_parms.device_trans_parm();
-      amrex::Real dt = amrex::ReduceMin(
-        stateMF, flags, 0,
-        [=] AMREX_GPU_HOST_DEVICE(
-          amrex::Box const& bx, const amrex::Array4<const amrex::Real>& fab_arr,
-          const amrex::Array4<const amrex::EBCellFlag>& flag_arr)
-          -> amrex::Real {
-          return pc_estdt_tempdif(
-            bx, fab_arr, flag_arr, AMREX_D_DECL(dx1, dx2, dx3), ltransparm);
+#ifdef AMREX_USE_OMP
+#pragma omp parallel if (amrex::Gpu::notInLaunchRegion())
+#endif
+    for (amrex::MFIter mfi(stateMF, amrex::TilingIfNotGPU()); mfi.isValid();
+         ++mfi) {
+      const amrex::Box& bx = mfi.tilebox();
+      auto const& sarr = stateMF.const_array(mfi);
+      auto const& flagarr = flags.const_array(mfi);
+      auto const& coefarr = use_coef ? prim_coeff.const_array(mfi)
+                                     : amrex::Array4<const amrex::Real>{};
+      reduce_op.eval(
+        bx, reduce_data,
+        [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept -> ReduceTuple {
+          return pc_estdt_cell(
+            i, j, k, sarr, flagarr, coefarr, dxa, l_do_hydro, l_diffuse_vel,
+            l_diffuse_temp, l_diffuse_enth, ltransparm);
         });
-      estdt_tdif = amrex::min<amrex::Real>(estdt_tdif, dt);
     }
 
-    if (diffuse_enth) {
-      auto const* ltransparm = trans_parms.device_trans_parm();
-      amrex::Real dt = amrex::ReduceMin(
-        stateMF, flags, 0,
-        [=] AMREX_GPU_HOST_DEVICE(
-          amrex::Box const& bx, const amrex::Array4<const amrex::Real>& fab_arr,
-          const amrex::Array4<const amrex::EBCellFlag>& flag_arr)
-          -> amrex::Real {
-          return pc_estdt_enthdif(
-            bx, fab_arr, flag_arr, AMREX_D_DECL(dx1, dx2, dx3), ltransparm);
-        });
-      estdt_edif = amrex::min<amrex::Real>(estdt_edif, dt);
+    ReduceTuple hv = reduce_data.value(reduce_op);
+    amrex::Real estdt_lim[ESTDT_NUM] = {
+      amrex::get<ESTDT_HYDRO>(hv), amrex::get<ESTDT_VELDIF>(hv),
+      amrex::get<ESTDT_TEMPDIF>(hv), amrex::get<ESTDT_ENTHDIF>(hv)};
+    amrex::ParallelDescriptor::ReduceRealMin(estdt_lim, ESTDT_NUM);
+
+    // Start the limits with the max_dt value, but divide by CFL to account
+    // for the fact that we multiply by it at the end. This ensures that if
+    // max_dt is more restrictive than the hydro and diffusion criteria, we
+    // will get exactly max_dt for a timestep.
+    const std::array<std::string, ESTDT_NUM> lim_names = {
+      "hydro", "viscous", "conductive", "enthalpy-diffusive"};
+    const std::array<bool, ESTDT_NUM> lim_active = {
+      do_hydro, diffuse_vel, diffuse_temp, diffuse_enth};
+    int ilim = ESTDT_HYDRO;
+    amrex::Real estdt_cfl = max_dt_over_cfl;
+    for (int n = 0; n < ESTDT_NUM; n++) {
+      AMREX_ALWAYS_ASSERT_WITH_MESSAGE(
+        estdt_lim[n] > 0.0, "ERROR: dt needs to be positive.");
+      estdt_lim[n] = amrex::min<amrex::Real>(estdt_lim[n], max_dt_over_cfl);
+      if (estdt_lim[n] < estdt_cfl) {
+        estdt_cfl = estdt_lim[n];
+        ilim = n;
+      }
     }
-
-    estdt_hydro = amrex::min<amrex::Real>(
-      estdt_hydro,
-      amrex::min<amrex::Real>(
-        estdt_vdif, amrex::min<amrex::Real>(estdt_tdif, estdt_edif)));
-
-    amrex::ParallelDescriptor::ReduceRealMin(estdt_hydro);
-    estdt_hydro *= cfl;
+    estdt_cfl *= cfl;
 
     if (verbose != 0) {
-      amrex::Print() << "...estimated hydro-limited timestep at level " << level
-                     << ": " << estdt_hydro << std::endl;
+      amrex::Print() << "...estimated timestep limits at level " << level
+                     << ":";
+      for (int n = 0; n < ESTDT_NUM; n++) {
+        if (lim_active[n]) {
+          amrex::Print() << " " << lim_names[n] << " "
+                         << estdt_lim[n] * cfl;
+        }
+      }
+      amrex::Print() << std::endl;
     }
 
     // Determine if this is more restrictive than the maximum timestep limiting
-    if (estdt_hydro < estdt) {
-      limiter = "hydro";
-      estdt = estdt_hydro;
+    if (estdt_cfl < estdt) {
+      limiter = lim_names[ilim];
+      estdt = estdt_cfl;
     }
   }
 
@@ -1027,6 +1049,9 @@ PeleC::post_timestep(int iteration)
 {
   BL_PROFILE("PeleC::post_timestep()");
 
+  // Refluxing and averaging down may change the new state
+  sborder_holds_new_state = false;
+
   const int finest_level = parent->finestLevel();
 
 #ifdef PELEC_USE_SPRAY
@@ -1103,6 +1128,7 @@ void
 PeleC::post_restart()
 {
   BL_PROFILE("PeleC::post_restart()");
+  sborder_holds_new_state = false;
 
   // Copy problem parameter structs to device
   amrex::Gpu::copy(
@@ -1139,6 +1165,23 @@ PeleC::postCoarseTimeStep(amrex::Real cumtime)
 {
   BL_PROFILE("PeleC::postCoarseTimeStep()");
   AmrLevel::postCoarseTimeStep(cumtime);
+
+  if (verbose > 0) {
+    if (turb_inflow_planes.active()) {
+      turb_inflow_planes.print_stats("Turbulent inflow");
+    }
+    if (prob_inflow_planes.active()) {
+      prob_inflow_planes.print_stats("Problem inflow");
+    }
+    if (turb_inflow_planes.active() || prob_inflow_planes.active()) {
+      amrex::Real fill_time = bcfill_hyp_time;
+      amrex::ParallelDescriptor::ReduceRealMax(
+        fill_time, amrex::ParallelDescriptor::IOProcessorNumber());
+      amrex::Print() << "Physical boundary fills (pc_bcfill_hyp): "
+                     << fill_time << " s so far with pelec.bndry_plane_cache = "
+                     << bndry_plane_cache << std::endl;
+    }
+  }
 }
 
 void
@@ -1146,6 +1189,10 @@ PeleC::post_regrid(int lbase, int /*new_finest*/)
 {
   BL_PROFILE("PeleC::post_regrid()");
   fine_mask.clear();
+  clear_react_workspace();
+  clear_primitive_cache();
+  turb_inflow_planes.clear();
+  prob_inflow_planes.clear();
 
 #ifdef PELEC_USE_SPRAY
   if (lbase == level) {
@@ -1164,6 +1211,7 @@ void
 PeleC::post_init(amrex::Real /*stop_time*/)
 {
   BL_PROFILE("PeleC::post_init()");
+  sborder_holds_new_state = false;
 
   amrex::Real dtlev = parent->dtLevel(level);
   amrex::Real cumtime = parent->cumTime();
@@ -1380,16 +1428,12 @@ PeleC::errorEst(
 {
   BL_PROFILE("PeleC::errorEst()");
 
-  amrex::MultiFab S_data(
-    get_new_data(State_Type).boxArray(),
-    get_new_data(State_Type).DistributionMap(), NVAR, 1, amrex::MFInfo(),
-    Factory());
-  const amrex::Real cur_time = state[State_Type].curTime();
-  FillPatch(
-    *this, S_data, S_data.nGrow(), cur_time, State_Type, Density, NVAR, 0);
-
-  amrex::Vector<amrex::BCRec> bcs(NVAR);
   const char tagval = amrex::TagBox::SET;
+  const amrex::Real cur_time = state[State_Type].curTime();
+  const amrex::MultiFab& S_new = get_new_data(State_Type);
+  const TagPlan plan = tag_plan();
+  constexpr bool has_problem_tags =
+    !std::is_same<ProblemTags, EmptyProbTagStruct>::value;
 
   // Tag EB
   if (eb_in_domain) {
@@ -1398,223 +1442,89 @@ PeleC::errorEst(
        (level < tagging_parm->max_eb_refine_lev)) ||
       ((tagging_parm->eb_refine_type == "adaptive") &&
        (level < tagging_parm->adapt_eb_refined_lev))) {
-      amrex::TagCutCells(tags, S_data);
+      amrex::TagCutCells(tags, S_new);
     }
   }
 
+  if (plan.any() || has_problem_tags) {
+    // The state only needs filled grow cells for the criteria that look at
+    // neighbouring cells (and for problem specific tagging). Sborder is used
+    // for it when allocated and is left holding the new state, so that it is
+    // not filled again if this level is tagged again before it changes.
+    const amrex::MultiFab* S_tag = &S_new;
+    amrex::MultiFab S_data;
+    if (plan.needs_grow_cells() || has_problem_tags) {
+      if (Sborder.ok() && (Sborder.nGrow() >= 1)) {
+        if (
+          !sborder_holds_new_state || !primitive_cache_matches(cur_time, 1)) {
+          FillPatch(*this, Sborder, 1, cur_time, State_Type, Density, NVAR, 0);
+          reset_primitive_cache(Sborder, 1, cur_time);
+          sborder_holds_new_state = true;
+        }
+        S_tag = &Sborder;
+      } else {
+        S_data.define(grids, dmap, NVAR, 1, amrex::MFInfo(), Factory());
+        FillPatch(*this, S_data, 1, cur_time, State_Type, Density, NVAR, 0);
+        S_tag = &S_data;
+      }
+    }
+
+    const ProbParmDevice* lprobparm = d_prob_parm_device;
+    const amrex::GpuArray<amrex::Real, AMREX_SPACEDIM> dx =
+      geom.CellSizeArray();
+    const amrex::GpuArray<amrex::Real, AMREX_SPACEDIM> prob_lo =
+      geom.ProbLoArray();
+    const auto captured_level = level;
+
 #ifdef AMREX_USE_OMP
 #pragma omp parallel if (amrex::Gpu::notInLaunchRegion())
 #endif
-  {
-    for (amrex::MFIter mfi(S_data, amrex::TilingIfNotGPU()); mfi.isValid();
+    for (amrex::MFIter mfi(*S_tag, amrex::TilingIfNotGPU()); mfi.isValid();
          ++mfi) {
       const amrex::Box& tilebox = mfi.tilebox();
-      const auto Sfab = S_data.array(mfi);
+      const auto Sfab = S_tag->const_array(mfi);
       auto tag_arr = tags.array(mfi);
-      const auto datbox = amrex::grow(tilebox, 1);
-      const auto vfrac_arr = vfrac.array(mfi);
-
-      amrex::FArrayBox S_derData(datbox, 1, amrex::The_Async_Arena());
-      auto S_derarr = S_derData.array();
-      const int ncp = S_derData.nComp();
-      const int* bc = bcs[0].data();
-
-      // Tagging density
-      if (level < tagging_parm->max_denerr_lev) {
-        const amrex::Real captured_denerr = tagging_parm->denerr;
-        amrex::ParallelFor(
-          tilebox, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
-            tag_error(i, j, k, tag_arr, Sfab, captured_denerr, tagval);
-          });
-      }
-      if (level < tagging_parm->max_dengrad_lev) {
-        const amrex::Real captured_dengrad = tagging_parm->dengrad;
-        amrex::ParallelFor(
-          tilebox, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
-            tag_graderror(i, j, k, tag_arr, Sfab, captured_dengrad, tagval);
-          });
-      }
-      if (level < tagging_parm->max_denratio_lev) {
-        const amrex::Real captured_denratio = tagging_parm->denratio;
-        amrex::ParallelFor(
-          tilebox, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
-            tag_ratioerror(i, j, k, tag_arr, Sfab, captured_denratio, tagval);
-          });
-      }
-
-      // Tagging pressure
-      S_derData.setVal<amrex::RunOn::Device>(0.0, datbox);
-      pc_derpres(
-        datbox, S_derData, ncp, Sfab.nComp(), S_data[mfi], geom, time, bc,
-        level);
-      if (level < tagging_parm->max_presserr_lev) {
-        const amrex::Real captured_presserr = tagging_parm->presserr;
-        amrex::ParallelFor(
-          tilebox, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
-            tag_error(i, j, k, tag_arr, S_derarr, captured_presserr, tagval);
-          });
-      }
-      if (level < tagging_parm->max_pressgrad_lev) {
-        const amrex::Real captured_pressgrad = tagging_parm->pressgrad;
+      const auto vfrac_arr = vfrac.const_array(mfi);
+      const auto& flag_fab = amrex::getEBCellFlagFab((*S_tag)[mfi]);
+      const auto typ = flag_fab.getType(tilebox);
+      const auto flags = flag_fab.const_array();
+      const bool all_regular = typ == amrex::FabType::regular;
+      const bool covered = typ == amrex::FabType::covered;
+
+      // Fields needed at neighbouring cells
+      amrex::FArrayBox der_fab;
+      if (plan.nderive > 0) {
+        const amrex::Box datbox = amrex::grow(tilebox, 1);
+        der_fab.resize(datbox, plan.nderive, amrex::The_Async_Arena());
+        const auto der_arr = der_fab.array();
         amrex::ParallelFor(
-          tilebox, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
-            tag_graderror(
-              i, j, k, tag_arr, S_derarr, captured_pressgrad, tagval);
+          datbox, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
+            pc_tag_derive(i, j, k, Sfab, der_arr, plan);
           });
       }
+      const auto der = der_fab.const_array();
 
-      // Tagging vel_x
-      S_derData.setVal<amrex::RunOn::Device>(0.0, datbox);
-      pc_dervelx(
-        datbox, S_derData, ncp, Sfab.nComp(), S_data[mfi], geom, time, bc,
-        level);
-      if (level < tagging_parm->max_velerr_lev) {
-        const amrex::Real captured_velerr = tagging_parm->velerr;
-        amrex::ParallelFor(
-          tilebox, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
-            tag_abserror(i, j, k, tag_arr, S_derarr, captured_velerr, tagval);
-          });
-      }
-      if (level < tagging_parm->max_velgrad_lev) {
-        const amrex::Real captured_velgrad = tagging_parm->velgrad;
-        amrex::ParallelFor(
-          tilebox, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
-            tag_graderror(i, j, k, tag_arr, S_derarr, captured_velgrad, tagval);
-          });
-      }
-
-      // Tagging vel_y
-      S_derData.setVal<amrex::RunOn::Device>(0.0, datbox);
-      pc_dervely(
-        datbox, S_derData, ncp, Sfab.nComp(), S_data[mfi], geom, time, bc,
-        level);
-      if (level < tagging_parm->max_velerr_lev) {
-        const amrex::Real captured_velerr = tagging_parm->velerr;
-        amrex::ParallelFor(
-          tilebox, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
-            tag_abserror(i, j, k, tag_arr, S_derarr, captured_velerr, tagval);
-          });
-      }
-      if (level < tagging_parm->max_velgrad_lev) {
-        const amrex::Real captured_velgrad = tagging_parm->velgrad;
-        amrex::ParallelFor(
-          tilebox, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
-            tag_graderror(i, j, k, tag_arr, S_derarr, captured_velgrad, tagval);
-          });
-      }
-
-      // Tagging vel_z
-      S_derData.setVal<amrex::RunOn::Device>(0.0, datbox);
-      pc_dervelz(
-        datbox, S_derData, ncp, Sfab.nComp(), S_data[mfi], geom, time, bc,
-        level);
-      if (level < tagging_parm->max_velerr_lev) {
-        const amrex::Real captured_velerr = tagging_parm->velerr;
-        amrex::ParallelFor(
-          tilebox, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
-            tag_abserror(i, j, k, tag_arr, S_derarr, captured_velerr, tagval);
-          });
-      }
-      if (level < tagging_parm->max_velgrad_lev) {
-        const amrex::Real captured_velgrad = tagging_parm->velgrad;
-        amrex::ParallelFor(
-          tilebox, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
-            tag_graderror(i, j, k, tag_arr, S_derarr, captured_velgrad, tagval);
-          });
-      }
-
-      // Tagging magnitude of vorticity
-      S_derData.setVal<amrex::RunOn::Device>(0.0, datbox);
-      pc_dermagvort(
-        tilebox, S_derData, ncp, Sfab.nComp(), S_data[mfi], geom, time, bc,
-        level);
-      if (level < tagging_parm->max_vorterr_lev) {
-        const amrex::Real vorterr =
-          tagging_parm->vorterr * std::pow(2.0, level);
-        amrex::ParallelFor(
-          tilebox, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
-            tag_abserror(i, j, k, tag_arr, S_derarr, vorterr, tagval);
-          });
-      }
-
-      // Tagging temperature
-      S_derData.setVal<amrex::RunOn::Device>(0.0, datbox);
-      pc_dertemp(
-        datbox, S_derData, ncp, Sfab.nComp(), S_data[mfi], geom, time, bc,
-        level);
-      if (level < tagging_parm->max_temperr_lev) {
-        const amrex::Real captured_temperr = tagging_parm->temperr;
-        amrex::ParallelFor(
-          tilebox, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
-            tag_error(i, j, k, tag_arr, S_derarr, captured_temperr, tagval);
-          });
-      }
-      if (level < tagging_parm->max_lotemperr_lev) {
-        const amrex::Real captured_lotemperr = tagging_parm->lotemperr;
-        amrex::ParallelFor(
-          tilebox, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
-            tag_loerror(i, j, k, tag_arr, S_derarr, captured_lotemperr, tagval);
-          });
-      }
-      if (level < tagging_parm->max_tempgrad_lev) {
-        const amrex::Real captured_tempgrad = tagging_parm->tempgrad;
-        amrex::ParallelFor(
-          tilebox, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
-            tag_graderror(
-              i, j, k, tag_arr, S_derarr, captured_tempgrad, tagval);
-          });
-      }
+      amrex::ParallelFor(
+        tilebox, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
+          pc_tag_cell(
+            i, j, k, tag_arr, Sfab, der, vfrac_arr, flags, all_regular,
+            covered, dx, plan, tagval);
+          set_problem_tags<ProblemTags>(
+            i, j, k, tag_arr, Sfab, tagval, dx, prob_lo, time, captured_level,
+            *lprobparm);
+        });
 
-      // Tagging flame tracer
-      if (!flame_trac_name.empty()) {
-        int idx = find_position(spec_names, flame_trac_name);
-
-        if (idx >= 0) {
-          S_derData.setVal<amrex::RunOn::Device>(0.0, datbox);
-          pc_derspectrac(
-            datbox, S_derData, ncp, Sfab.nComp(), S_data[mfi], geom, time, bc,
-            level, idx);
-
-          if (level < tagging_parm->max_ftracerr_lev) {
-            const amrex::Real captured_ftracerr = tagging_parm->ftracerr;
-            amrex::ParallelFor(
-              tilebox, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
-                tag_error(
-                  i, j, k, tag_arr, S_derarr, captured_ftracerr, tagval);
-              });
-          }
-          if (level < tagging_parm->max_ftracgrad_lev) {
-            const amrex::Real captured_ftracgrad = tagging_parm->ftracgrad;
-            amrex::ParallelFor(
-              tilebox, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
-                tag_graderror(
-                  i, j, k, tag_arr, S_derarr, captured_ftracgrad, tagval);
-              });
+      // Tagging the cut cells for the volume fraction
+      if (plan.do_vfracerr) {
+        const int local_i = mfi.LocalIndex();
+        const auto Nebg = sv_eb_bndry_geom[local_i].size();
+        EBBndryGeom* ebg = sv_eb_bndry_geom[local_i].data();
+        amrex::ParallelFor(Nebg, [=] AMREX_GPU_DEVICE(int L) {
+          const auto& iv = ebg[L].iv;
+          if (tilebox.contains(iv)) {
+            tag_arr(iv) = tagval;
           }
-
-        } else {
-          amrex::Abort("Unknown species identified as flame_trac_name");
-        }
-      }
-
-      if (eb_in_domain) {
-        // Tagging volume fraction
-        if (level < tagging_parm->max_vfracerr_lev) {
-          amrex::ParallelFor(
-            tilebox, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
-              tag_error_bounds(i, j, k, tag_arr, vfrac_arr, 0.0, 1.0, tagval);
-            });
-
-          const int local_i = mfi.LocalIndex();
-          const auto Nebg = sv_eb_bndry_geom[local_i].size();
-          EBBndryGeom* ebg = sv_eb_bndry_geom[local_i].data();
-          amrex::ParallelFor(Nebg, [=] AMREX_GPU_DEVICE(int L) {
-            const auto& iv = ebg[L].iv;
-            if (tilebox.contains(iv)) {
-              tag_arr(iv) = tagval;
-            }
-          });
-        }
+        });
       }
     }
   }
@@ -1632,32 +1542,6 @@ PeleC::errorEst(
       geom);
   }
 
-#ifdef AMREX_USE_OMP
-#pragma omp parallel if (amrex::Gpu::notInLaunchRegion())
-#endif
-  {
-    for (amrex::MFIter mfi(S_data, amrex::TilingIfNotGPU()); mfi.isValid();
-         ++mfi) {
-      const amrex::Box& tilebox = mfi.tilebox();
-      const auto Sfab = S_data.array(mfi);
-      auto tag_arr = tags.array(mfi);
-
-      // Problem specific tagging
-      const ProbParmDevice* lprobparm = d_prob_parm_device;
-      const amrex::GpuArray<amrex::Real, AMREX_SPACEDIM> dx =
-        geom.CellSizeArray();
-      const amrex::GpuArray<amrex::Real, AMREX_SPACEDIM> prob_lo =
-        geom.ProbLoArray();
-      const auto captured_level = level;
-      amrex::ParallelFor(
-        tilebox, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
-          set_problem_tags<ProblemTags>(
-            i, j, k, tag_arr, Sfab, tagval, dx, prob_lo, time, captured_level,
-            *lprobparm);
-        });
-    }
-  }
-
   // Untag cell close to EB, do this last
   if (
     eb_in_domain && (tagging_parm->eb_refine_type == "static") &&
@@ -1791,6 +1675,12 @@ PeleC::init_les()
   } else {
     LES_Coeffs.setVal(PrT, comp_PrT, 1, LES_Coeffs.nGrow());
   }
+  les_coeffs_step = -1;
+
+  if (les_model == 1) {
+    les_test_filter = Filter(les_test_filter_type, les_test_filter_fgr);
+    les_coeff_filter = Filter(box, 6);
+  }
 
   amrex::Print() << "WARNING: LES with Fuego assumes Cp is a weak function of T"
                  << std::endl;
@@ -1935,6 +1825,94 @@ PeleC::reset_internal_energy(amrex::MultiFab& S_new, int ng)
 #endif
 }
 
+void
+PeleC::fused_state_update(
+  amrex::MultiFab& S,
+  const amrex::Vector<StateUpdateTerm>& terms,
+  const int ng,
+  const bool compute_temp)
+{
+  BL_PROFILE("PeleC::fused_state_update()");
+
+  // Old and new halves of every source, plus the state, hydro and I_R
+  constexpr int max_terms = 2 * num_src + 4;
+  const int nterms = static_cast<int>(terms.size());
+  AMREX_ALWAYS_ASSERT(nterms <= max_terms);
+
+  amrex::GpuArray<amrex::MultiArray4<amrex::Real const>, max_terms> tarrs;
+  amrex::GpuArray<amrex::Real, max_terms> tweight{};
+  amrex::GpuArray<int, max_terms> tscomp{};
+  amrex::GpuArray<int, max_terms> tdcomp{};
+  amrex::GpuArray<int, max_terms> tncomp{};
+  for (int t = 0; t < nterms; ++t) {
+    const amrex::MultiFab& mf = *terms[t].mf;
+    AMREX_ASSERT(
+      (mf.boxArray() == S.boxArray()) &&
+      (mf.DistributionMap() == S.DistributionMap()) && (mf.nGrow() >= ng));
+    tarrs[t] = mf.const_arrays();
+    tweight[t] = terms[t].weight;
+    tscomp[t] = terms[t].scomp;
+    tdcomp[t] = terms[t].dcomp;
+    tncomp[t] = terms[t].ncomp;
+  }
+
+  // The energy diagnostics of reset_internal_energy need their own passes
+  bool fuse_temp = compute_temp;
+#ifndef AMREX_USE_GPU
+  if (parent->finestLevel() == 0 && print_energy_diagnostics) {
+    fuse_temp = false;
+  }
+#endif
+
+  // Only the state has an EB factory, the sources may not
+  amrex::MultiArray4<amrex::EBCellFlag const> flagarrs;
+  if (fuse_temp) {
+    auto const& fact =
+      dynamic_cast<amrex::EBFArrayBoxFactory const&>(S.Factory());
+    flagarrs = fact.getMultiEBCellFlagFab().const_arrays();
+  }
+  auto const& sarrs = S.arrays();
+  const auto captured_allow_small_energy = allow_small_energy;
+  const auto captured_allow_negative_energy = allow_negative_energy;
+  const auto captured_dual_energy_update_E_from_e =
+    dual_energy_update_E_from_e;
+  const auto captured_verbose = verbose;
+  const auto captured_dual_energy_eta2 = dual_energy_eta2;
+  amrex::ParallelFor(
+    S, amrex::IntVect(ng),
+    [=] AMREX_GPU_DEVICE(int nbx, int i, int j, int k) noexcept {
+      auto const& s = sarrs[nbx];
+      for (int n = 0; n < NVAR; ++n) {
+        bool covered_by_term = false;
+        amrex::Real sum = 0.0;
+        for (int t = 0; t < nterms; ++t) {
+          const int m = n - tdcomp[t];
+          if ((m >= 0) && (m < tncomp[t])) {
+            sum += tweight[t] * tarrs[t][nbx](i, j, k, tscomp[t] + m);
+            covered_by_term = true;
+          }
+        }
+        if (covered_by_term) {
+          s(i, j, k, n) = sum;
+        }
+      }
+      if (fuse_temp) {
+        pc_rst_int_e(
+          i, j, k, s, captured_allow_small_energy,
+          captured_allow_negative_energy, captured_dual_energy_update_E_from_e,
+          captured_dual_energy_eta2, captured_verbose);
+        if (!flagarrs[nbx](i, j, k).isCovered()) {
+          pc_cmpTemp(i, j, k, s);
+        }
+      }
+    });
+  amrex::Gpu::synchronize();
+
+  if (compute_temp && !fuse_temp) {
+    computeTemp(S, ng);
+  }
+}
+
 void
 PeleC::computeTemp(amrex::MultiFab& S, int ng)
 {
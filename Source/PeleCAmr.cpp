@@ -1,9 +1,65 @@
 #include "PeleCAmr.H"
+#include "Derive.H"
+#include "QuantizedPlotFile.H"
 
 #ifdef PELEC_USE_SPRAY
 #include "SprayParticles.H"
 #endif
 
+PeleCAmr::~PeleCAmr() { finishAsyncOutput(); }
+
+void
+PeleCAmr::asyncOutputBegin()
+{
+  if (!amrex::AsyncOut::UseAsyncOut()) {
+    return;
+  }
+
+  int max_pending = 2;
+  amrex::ParmParse pp("pelec");
+  pp.query("async_output_max_pending", max_pending);
+
+  // Each queued output holds a snapshot of its data, so stall here rather
+  // than let the queue (and its memory) grow without bound
+  if (async_pending.load() >= amrex::max(max_pending, 1)) {
+    const amrex::Real wait0 = amrex::second();
+    amrex::AsyncOut::Finish();
+    if (verbose > 0) {
+      amrex::Print() << "Waited " << amrex::second() - wait0
+                     << " seconds for queued output to be written\n";
+    }
+  }
+  ++async_pending;
+}
+
+void
+PeleCAmr::asyncOutputEnd()
+{
+  if (!amrex::AsyncOut::UseAsyncOut()) {
+    return;
+  }
+
+  // The I/O thread runs jobs in order, so this retires the output only after
+  // all of its data has been written
+  amrex::AsyncOut::Submit([this]() { --async_pending; });
+}
+
+void
+PeleCAmr::finishAsyncOutput()
+{
+  if (amrex::AsyncOut::UseAsyncOut()) {
+    amrex::AsyncOut::Finish();
+  }
+}
+
+void
+PeleCAmr::checkPoint()
+{
+  asyncOutputBegin();
+  amrex::Amr::checkPoint();
+  asyncOutputEnd();
+}
+
 void
 PeleCAmr::writePlotFile()
 {
@@ -123,6 +179,10 @@ PeleCAmr::constructPlotMF(
   amrex::ParmParse pp("pelec");
   pp.query("plot_vfrac", plot_vfrac);
 
+  // Evaluate the pointwise derives in a single fused pass over the state
+  bool fused_plot_derive = true;
+  pp.query("fused_plot_derive", fused_plot_derive);
+
   const auto n_data_items =
     plot_var_map.size() + num_derive + static_cast<int>(plot_vfrac);
 
@@ -147,16 +207,29 @@ PeleCAmr::constructPlotMF(
       cnt++;
     }
 
-    // Cull data from derived variables.
+    // Cull data from derived variables. Pointwise derives of the state are
+    // computed together straight into the plot MultiFab, the rest go through
+    // the generic derive.
     if ((!derive_names.empty())) {
+      amrex::Vector<std::pair<int, int>> fused;
       for (const auto& derive_name : derive_names) {
         const amrex::DeriveRec* rec = derive_lst.get(derive_name);
         int ncomp = rec->numDerive();
 
-        auto derive_dat = amr_level[lev]->derive(derive_name, cur_time, nGrow);
-        amrex::MultiFab::Copy(*plotMFs[lev], *derive_dat, 0, cnt, ncomp, nGrow);
+        const int fid =
+          fused_plot_derive ? pc_fused_derive_id(derive_name) : -1;
+        if (fid >= 0) {
+          fused.push_back(std::pair<int, int>(fid, cnt));
+        } else {
+          auto derive_dat =
+            amr_level[lev]->derive(derive_name, cur_time, nGrow);
+          amrex::MultiFab::Copy(
+            *plotMFs[lev], *derive_dat, 0, cnt, ncomp, nGrow);
+        }
         cnt += ncomp;
       }
+      dynamic_cast<PeleC&>(*amr_level[lev])
+        .derivePlotFused(fused, *plotMFs[lev]);
     }
 
 #ifdef PELEC_USE_SPRAY
@@ -229,6 +302,8 @@ PeleCAmr::writePlotFileDoit(
 {
   auto dPlotFileTime0 = amrex::second();
 
+  asyncOutputBegin();
+
   const int nlevels = finestLevel() + 1;
   amrex::Vector<std::string> plt_var_names;
   amrex::Vector<std::unique_ptr<amrex::MultiFab>> plotMFs(nlevels);
@@ -248,6 +323,22 @@ PeleCAmr::writePlotFileDoit(
     istep[lev] = levelSteps(lev);
   }
 
+  // Precision of the plot data: double, float (native plotfile with 32 bit
+  // data) or quantized (error-bounded, see QuantizedPlotFile.H)
+  std::string plot_precision{"double"};
+  amrex::Real plot_quant_tol = 1.0e-6;
+  bool plot_quant_check = false;
+  amrex::ParmParse pp("pelec");
+  pp.query("plot_precision", plot_precision);
+  pp.query("plot_quant_tol", plot_quant_tol);
+  pp.query("plot_quant_check", plot_quant_check);
+  if (
+    plot_precision != "double" && plot_precision != "float" &&
+    plot_precision != "quantized") {
+    amrex::Abort("pelec.plot_precision must be double, float or quantized");
+  }
+  const bool quantized = (plot_precision == "quantized") && !write_hdf5_plots;
+
 #ifdef AMREX_USE_HDF5
   if (write_hdf5_plots) {
     amrex::WriteMultiLevelPlotfileHDF5SingleDset(
@@ -256,16 +347,35 @@ PeleCAmr::writePlotFileDoit(
   } else {
 #endif
     (void)hdf5_compression; // Avoid unused warning
-    amrex::WriteMultiLevelPlotfile(
-      pltfile, nlevels, plotMFs_constvec, plt_var_names, Geom(), cur_time,
-      istep, refRatio());
+    if (quantized) {
+      pc_write_quantized_plotfile(
+        pltfile, nlevels, plotMFs_constvec, plt_var_names, Geom(), cur_time,
+        istep, refRatio(), plot_quant_tol);
+      if (plot_quant_check) {
+        const amrex::Real err = pc_check_quantized_plotfile(
+          pltfile, nlevels, plotMFs_constvec, plot_quant_tol);
+        amrex::Print() << "Quantized plotfile " << pltfile
+                       << " read back with a maximum error of " << err
+                       << " times the value range (bound " << plot_quant_tol
+                       << ")" << std::endl;
+      }
+    } else {
+      const auto fab_format = amrex::FArrayBox::getFormat();
+      if (plot_precision == "float") {
+        amrex::FArrayBox::setFormat(amrex::FABio::FAB_NATIVE_32);
+      }
+      amrex::WriteMultiLevelPlotfile(
+        pltfile, nlevels, plotMFs_constvec, plt_var_names, Geom(), cur_time,
+        istep, refRatio());
+      amrex::FArrayBox::setFormat(fab_format);
+    }
 #ifdef AMREX_USE_HDF5
   }
 #endif
 
   amrex::VisMF::IO_Buffer io_buffer(amrex::VisMF::GetIOBufferSize());
   std::ofstream HeaderFile;
-  if (!write_hdf5_plots) {
+  if (!write_hdf5_plots && !quantized) {
     HeaderFile.rdbuf()->pubsetbuf(io_buffer.dataPtr(), io_buffer.size());
     if (amrex::ParallelDescriptor::IOProcessor()) {
       // Only the IOProcessor() writes to the header file.
@@ -308,6 +418,8 @@ PeleCAmr::writePlotFileDoit(
   }
 #endif
 
+  asyncOutputEnd();
+
   if (verbose > 0) {
     const int IOProc = amrex::ParallelDescriptor::IOProcessorNumber();
     auto dPlotFileTime = amrex::second() - dPlotFileTime0;
@@ -0,0 +1,573 @@
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <limits>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <AMReX_Utility.H>
+#include <AMReX_PlotFileUtil.H>
+#include <AMReX_ParallelDescriptor.H>
+
+#include "QuantizedPlotFile.H"
+
+namespace {
+const std::string quant_header_name = "QuantHeader";
+const std::string quant_version = "PeleC-QuantizedPlotfile-V1";
+const std::string quant_level_prefix = "Level_";
+const std::string quant_data_prefix = "Cell_Q_";
+
+// How each component of a grid is stored
+enum quant_modes { quant_rice = 0, quant_constant, quant_raw };
+
+// Rice quotients from this value on are escaped and stored as raw 64 bits
+constexpr std::uint64_t rice_escape = 24;
+
+std::uint64_t
+real_bits(const double x)
+{
+  std::uint64_t b;
+  std::memcpy(&b, &x, sizeof(b));
+  return b;
+}
+
+double
+bits_real(const std::uint64_t b)
+{
+  double x;
+  std::memcpy(&x, &b, sizeof(x));
+  return x;
+}
+
+std::uint64_t
+bit_mask(const int nbits)
+{
+  return nbits >= 64 ? ~std::uint64_t(0) : (std::uint64_t(1) << nbits) - 1;
+}
+
+// LSB-first bit stream appended to a byte buffer
+class BitWriter
+{
+public:
+  explicit BitWriter(std::vector<unsigned char>& buf) : m_buf(buf) {}
+
+  void put(std::uint64_t v, int nbits)
+  {
+    while (nbits > 0) {
+      const int nb = amrex::min(nbits, 32);
+      m_acc |= (v & bit_mask(nb)) << m_nacc;
+      m_nacc += nb;
+      v >>= nb;
+      nbits -= nb;
+      while (m_nacc >= 8) {
+        m_buf.push_back(static_cast<unsigned char>(m_acc & 0xff));
+        m_acc >>= 8;
+        m_nacc -= 8;
+      }
+    }
+  }
+
+  void put_unary(std::uint64_t q)
+  {
+    for (; q >= 32; q -= 32) {
+      put(bit_mask(32), 32);
+    }
+    put(bit_mask(static_cast<int>(q)), static_cast<int>(q));
+    put(0, 1);
+  }
+
+  void flush()
+  {
+    if (m_nacc > 0) {
+      m_buf.push_back(static_cast<unsigned char>(m_acc & 0xff));
+    }
+    m_acc = 0;
+    m_nacc = 0;
+  }
+
+private:
+  std::vector<unsigned char>& m_buf;
+  std::uint64_t m_acc = 0;
+  int m_nacc = 0;
+};
+
+class BitReader
+{
+public:
+  BitReader(const unsigned char* p, const std::size_t n) : m_p(p), m_end(p + n)
+  {
+  }
+
+  std::uint64_t get(int nbits)
+  {
+    std::uint64_t v = 0;
+    int shift = 0;
+    while (nbits > 0) {
+      const int nb = amrex::min(nbits, 32);
+      while (m_nacc < nb) {
+        if (m_p == m_end) {
+          amrex::Abort("Truncated data in quantized plotfile");
+        }
+        m_acc |= static_cast<std::uint64_t>(*m_p++) << m_nacc;
+        m_nacc += 8;
+      }
+      v |= (m_acc & bit_mask(nb)) << shift;
+      m_acc >>= nb;
+      m_nacc -= nb;
+      shift += nb;
+      nbits -= nb;
+    }
+    return v;
+  }
+
+private:
+  const unsigned char* m_p;
+  const unsigned char* m_end;
+  std::uint64_t m_acc = 0;
+  int m_nacc = 0;
+};
+
+void
+quant_encode_fab(
+  const amrex::FArrayBox& fab,
+  const amrex::Box& bx,
+  const int ncomp,
+  const amrex::Real tol,
+  std::vector<unsigned char>& buf)
+{
+  BitWriter bw(buf);
+  const auto npts = static_cast<double>(bx.numPts());
+  const auto a = fab.const_array();
+
+  for (int n = 0; n < ncomp; n++) {
+    double vmin = std::numeric_limits<double>::max();
+    double vmax = std::numeric_limits<double>::lowest();
+    bool finite = true;
+    amrex::LoopOnCpu(bx, [&](int i, int j, int k) {
+      const double x = a(i, j, k, n);
+      finite = finite && std::isfinite(x);
+      vmin = amrex::min(vmin, x);
+      vmax = amrex::max(vmax, x);
+    });
+
+    if (!finite) {
+      bw.put(quant_raw, 2);
+      amrex::LoopOnCpu(
+        bx, [&](int i, int j, int k) { bw.put(real_bits(a(i, j, k, n)), 64); });
+      continue;
+    }
+
+    // Block-wise scaling: the quantization step is relative to the value
+    // range of this grid, so |x - x_q| <= tol * (vmax - vmin)
+    const double scale = 2.0 * tol * (vmax - vmin);
+    if (!(scale > 0.0) || !std::isfinite((vmax - vmin) / scale)) {
+      bw.put(quant_constant, 2);
+      bw.put(real_bits(vmin), 64);
+      continue;
+    }
+
+    // Delta code the quantized values along the grid and pick the Rice
+    // parameter from the mean zigzagged residual
+    auto zigzag_residual = [&](int i, int j, int k, std::int64_t& prev) {
+      const auto q =
+        static_cast<std::int64_t>(std::llround((a(i, j, k, n) - vmin) / scale));
+      const std::int64_t r = q - prev;
+      prev = q;
+      return (static_cast<std::uint64_t>(r) << 1) ^
+             static_cast<std::uint64_t>(r >> 63);
+    };
+
+    double zsum = 0.0;
+    std::int64_t prev = 0;
+    amrex::LoopOnCpu(bx, [&](int i, int j, int k) {
+      zsum += static_cast<double>(zigzag_residual(i, j, k, prev));
+    });
+    const double zmean = zsum / npts;
+    int kr = 0;
+    while (kr < 56 && static_cast<double>(std::uint64_t(1) << (kr + 1)) <=
+                        zmean) {
+      ++kr;
+    }
+
+    bw.put(quant_rice, 2);
+    bw.put(real_bits(vmin), 64);
+    bw.put(real_bits(scale), 64);
+    bw.put(kr, 6);
+    prev = 0;
+    amrex::LoopOnCpu(bx, [&](int i, int j, int k) {
+      const std::uint64_t z = zigzag_residual(i, j, k, prev);
+      const std::uint64_t q = z >> kr;
+      if (q < rice_escape) {
+        bw.put_unary(q);
+        bw.put(z, kr);
+      } else {
+        bw.put_unary(rice_escape);
+        bw.put(z, 64);
+      }
+    });
+  }
+  bw.flush();
+}
+
+void
+quant_decode_fab(
+  const std::vector<unsigned char>& buf,
+  amrex::FArrayBox& fab,
+  const amrex::Box& bx,
+  const int ncomp)
+{
+  BitReader br(buf.data(), buf.size());
+  const auto a = fab.array();
+
+  for (int n = 0; n < ncomp; n++) {
+    const auto mode = static_cast<int>(br.get(2));
+    if (mode == quant_raw) {
+      amrex::LoopOnCpu(bx, [&](int i, int j, int k) {
+        a(i, j, k, n) = bits_real(br.get(64));
+      });
+    } else if (mode == quant_constant) {
+      const double v = bits_real(br.get(64));
+      amrex::LoopOnCpu(bx, [&](int i, int j, int k) { a(i, j, k, n) = v; });
+    } else if (mode == quant_rice) {
+      const double vmin = bits_real(br.get(64));
+      const double scale = bits_real(br.get(64));
+      const auto kr = static_cast<int>(br.get(6));
+      std::int64_t prev = 0;
+      amrex::LoopOnCpu(bx, [&](int i, int j, int k) {
+        std::uint64_t q = 0;
+        while (br.get(1) != 0) {
+          ++q;
+        }
+        const std::uint64_t z =
+          (q == rice_escape) ? br.get(64) : ((q << kr) | br.get(kr));
+        const auto r =
+          static_cast<std::int64_t>(z >> 1) ^ -static_cast<std::int64_t>(z & 1);
+        prev += r;
+        a(i, j, k, n) = vmin + static_cast<double>(prev) * scale;
+      });
+    } else {
+      amrex::Abort("Unknown component mode in quantized plotfile");
+    }
+  }
+}
+
+std::string
+quant_data_file(const std::string& dir, const int lev, const int rank)
+{
+  return dir + "/" + quant_level_prefix + std::to_string(lev) + "/" +
+         amrex::Concatenate(quant_data_prefix, rank, 5);
+}
+} // namespace
+
+void
+pc_write_quantized_plotfile(
+  const std::string& dir,
+  const int nlevels,
+  const amrex::Vector<const amrex::MultiFab*>& mf,
+  const amrex::Vector<std::string>& varnames,
+  const amrex::Vector<amrex::Geometry>& geom,
+  const amrex::Real time,
+  const amrex::Vector<int>& level_steps,
+  const amrex::Vector<amrex::IntVect>& ref_ratio,
+  const amrex::Real tol)
+{
+  BL_PROFILE("pc_write_quantized_plotfile()");
+
+  if (!(tol > 0.0)) {
+    amrex::Abort("Quantized plotfiles need a positive tolerance");
+  }
+
+  const int myproc = amrex::ParallelDescriptor::MyProc();
+  const int ioproc = amrex::ParallelDescriptor::IOProcessorNumber();
+  amrex::PreBuildDirectorHierarchy(dir, quant_level_prefix, nlevels, true);
+
+  amrex::Vector<amrex::Vector<amrex::Long>> offsets(nlevels);
+  amrex::Vector<amrex::Vector<amrex::Long>> nbytes(nlevels);
+  for (int lev = 0; lev < nlevels; ++lev) {
+    const amrex::MultiFab& lmf = *mf[lev];
+    const int ncomp = lmf.nComp();
+    offsets[lev].resize(lmf.size(), 0);
+    nbytes[lev].resize(lmf.size(), 0);
+
+    std::vector<unsigned char> buf;
+    for (amrex::MFIter mfi(lmf); mfi.isValid(); ++mfi) {
+      const amrex::Box& bx = mfi.validbox();
+      amrex::FArrayBox hfab(bx, ncomp, amrex::The_Pinned_Arena());
+      hfab.copy<amrex::RunOn::Device>(lmf[mfi], bx, 0, bx, 0, ncomp);
+      amrex::Gpu::streamSynchronize();
+
+      const auto start = static_cast<amrex::Long>(buf.size());
+      quant_encode_fab(hfab, bx, ncomp, tol, buf);
+      offsets[lev][mfi.index()] = start;
+      nbytes[lev][mfi.index()] = static_cast<amrex::Long>(buf.size()) - start;
+    }
+
+    if (!buf.empty()) {
+      const std::string fname = quant_data_file(dir, lev, myproc);
+      std::ofstream ofs(fname, std::ios::out | std::ios::binary);
+      if (!ofs.good()) {
+        amrex::FileOpenFailed(fname);
+      }
+      ofs.write(
+        reinterpret_cast<const char*>(buf.data()),
+        static_cast<std::streamsize>(buf.size()));
+    }
+
+    amrex::ParallelDescriptor::ReduceLongSum(
+      offsets[lev].data(), static_cast<int>(offsets[lev].size()), ioproc);
+    amrex::ParallelDescriptor::ReduceLongSum(
+      nbytes[lev].data(), static_cast<int>(nbytes[lev].size()), ioproc);
+  }
+
+  if (amrex::ParallelDescriptor::IOProcessor()) {
+    const std::string fname = dir + "/" + quant_header_name;
+    std::ofstream os(fname, std::ios::out);
+    if (!os.good()) {
+      amrex::FileOpenFailed(fname);
+    }
+    os << std::setprecision(17);
+    os << quant_version << "\n" << varnames.size() << "\n";
+    for (const auto& name : varnames) {
+      os << name << "\n";
+    }
+    os << nlevels << "\n" << time << "\n" << tol << "\n";
+    for (int lev = 0; lev < nlevels; ++lev) {
+      os << level_steps[lev] << "\n" << geom[lev].Domain() << "\n";
+      if (lev < nlevels - 1) {
+        os << ref_ratio[lev] << "\n";
+      }
+      mf[lev]->boxArray().writeOn(os);
+      os << "\n";
+      const auto& dm = mf[lev]->DistributionMap();
+      for (int b = 0; b < mf[lev]->size(); b++) {
+        os << dm[b] << " " << offsets[lev][b] << " " << nbytes[lev][b]
+           << "\n";
+      }
+    }
+  }
+  amrex::ParallelDescriptor::Barrier();
+}
+
+bool
+pc_is_quantized_plotfile(const std::string& dir)
+{
+  return amrex::FileExists(dir + "/" + quant_header_name);
+}
+
+amrex::Real
+pc_check_quantized_plotfile(
+  const std::string& dir,
+  const int nlevels,
+  const amrex::Vector<const amrex::MultiFab*>& mf,
+  const amrex::Real tol)
+{
+  BL_PROFILE("pc_check_quantized_plotfile()");
+
+  QuantizedPltFile plt(dir);
+  amrex::Real max_rel_err = 0.0;
+  int nbad = 0;
+  for (int lev = 0; lev < nlevels; ++lev) {
+    const amrex::MultiFab& lmf = *mf[lev];
+    const int ncomp = lmf.nComp();
+    amrex::MultiFab decoded(
+      lmf.boxArray(), lmf.DistributionMap(), ncomp, 0,
+      amrex::MFInfo().SetArena(amrex::The_Pinned_Arena()));
+    decoded.ParallelCopy(plt.levelData(lev), 0, 0, ncomp);
+
+    for (amrex::MFIter mfi(lmf); mfi.isValid(); ++mfi) {
+      const amrex::Box& bx = mfi.validbox();
+      amrex::FArrayBox hfab(bx, ncomp, amrex::The_Pinned_Arena());
+      hfab.copy<amrex::RunOn::Device>(lmf[mfi], bx, 0, bx, 0, ncomp);
+      amrex::Gpu::streamSynchronize();
+      const auto a = hfab.const_array();
+      const auto d = decoded.const_array(mfi);
+
+      for (int n = 0; n < ncomp; n++) {
+        double vmin = std::numeric_limits<double>::max();
+        double vmax = std::numeric_limits<double>::lowest();
+        double err = 0.0;
+        amrex::LoopOnCpu(bx, [&](int i, int j, int k) {
+          vmin = amrex::min(vmin, a(i, j, k, n));
+          vmax = amrex::max(vmax, a(i, j, k, n));
+          err = amrex::max(err, std::abs(a(i, j, k, n) - d(i, j, k, n)));
+        });
+        const double range = vmax - vmin;
+        if (!std::isfinite(range)) {
+          // Stored as raw doubles
+          continue;
+        }
+        // Allow for the rounding of vmin + q * scale
+        const double bound =
+          tol * range + 4.0 * std::numeric_limits<double>::epsilon() *
+                          amrex::max(std::abs(vmin), std::abs(vmax));
+        if (!(err <= bound)) {
+          nbad++;
+        }
+        if (range > 0.0) {
+          max_rel_err =
+            amrex::max(max_rel_err, static_cast<amrex::Real>(err / range));
+        }
+      }
+    }
+  }
+
+  amrex::ParallelDescriptor::ReduceIntSum(nbad);
+  amrex::ParallelDescriptor::ReduceRealMax(max_rel_err);
+  if (nbad > 0) {
+    amrex::Abort(
+      "Quantized plotfile " + dir + " exceeds its error bound in " +
+      std::to_string(nbad) + " grid components");
+  }
+  return max_rel_err;
+}
+
+QuantizedPltFile::QuantizedPltFile(const std::string& dir) : m_dir(dir)
+{
+  amrex::Vector<char> file_chars;
+  amrex::ParallelDescriptor::ReadAndBcastFile(
+    dir + "/" + quant_header_name, file_chars);
+  std::string file_string(file_chars.dataPtr());
+  std::istringstream is(file_string, std::istringstream::in);
+
+  std::string version;
+  is >> version;
+  if (version != quant_version) {
+    amrex::Abort("Unknown quantized plotfile version " + version);
+  }
+
+  int ncomp = 0;
+  is >> ncomp;
+  m_varnames.resize(ncomp);
+  for (auto& name : m_varnames) {
+    is >> name;
+  }
+
+  amrex::Real tol = 0.0;
+  is >> m_nlevels >> m_time >> tol;
+  m_domain.resize(m_nlevels);
+  m_ref_ratio.resize(m_nlevels, amrex::IntVect(1));
+  m_grids.resize(m_nlevels);
+  m_file_rank.resize(m_nlevels);
+  m_offset.resize(m_nlevels);
+  m_nbytes.resize(m_nlevels);
+  m_data.resize(m_nlevels);
+  for (int lev = 0; lev < m_nlevels; ++lev) {
+    int step = 0;
+    is >> step >> m_domain[lev];
+    if (lev < m_nlevels - 1) {
+      is >> m_ref_ratio[lev];
+    }
+    m_grids[lev].readFrom(is);
+    const int nboxes = static_cast<int>(m_grids[lev].size());
+    m_file_rank[lev].resize(nboxes);
+    m_offset[lev].resize(nboxes);
+    m_nbytes[lev].resize(nboxes);
+    for (int b = 0; b < nboxes; b++) {
+      is >> m_file_rank[lev][b] >> m_offset[lev][b] >> m_nbytes[lev][b];
+    }
+  }
+
+  if (!is) {
+    amrex::Abort("Unable to parse quantized plotfile header in " + dir);
+  }
+}
+
+void
+QuantizedPltFile::readLevel(const int lev)
+{
+  BL_PROFILE("QuantizedPltFile::readLevel()");
+
+  const amrex::BoxArray& ba = m_grids[lev];
+  const amrex::DistributionMapping dm(ba);
+  const int ncomp = static_cast<int>(m_varnames.size());
+  m_data[lev] = std::make_unique<amrex::MultiFab>(
+    ba, dm, ncomp, 0, amrex::MFInfo().SetArena(amrex::The_Pinned_Arena()));
+
+  std::vector<unsigned char> buf;
+  std::ifstream ifs;
+  std::string open_name;
+  for (amrex::MFIter mfi(*m_data[lev]); mfi.isValid(); ++mfi) {
+    const int b = mfi.index();
+    const std::string fname = quant_data_file(m_dir, lev, m_file_rank[lev][b]);
+    if (fname != open_name) {
+      ifs.close();
+      ifs.open(fname, std::ios::in | std::ios::binary);
+      if (!ifs.good()) {
+        amrex::FileOpenFailed(fname);
+      }
+      open_name = fname;
+    }
+    buf.resize(m_nbytes[lev][b]);
+    ifs.seekg(m_offset[lev][b]);
+    ifs.read(
+      reinterpret_cast<char*>(buf.data()),
+      static_cast<std::streamsize>(buf.size()));
+    if (!ifs.good()) {
+      amrex::Abort("Unable to read grid data from " + fname);
+    }
+    quant_decode_fab(buf, (*m_data[lev])[mfi], mfi.validbox(), ncomp);
+  }
+}
+
+void
+QuantizedPltFile::fillPatchFromPlt(
+  const int lev,
+  const amrex::Geometry& geom,
+  const int pltComp,
+  const int dataComp,
+  const int nComp,
+  amrex::MultiFab& mf)
+{
+  AMREX_ALWAYS_ASSERT(
+    pltComp >= 0 && pltComp + nComp <= static_cast<int>(m_varnames.size()));
+
+  // Inject from each plotfile level up to lev in turn, so that finer
+  // plotfile data overwrites coarser data where it exists
+  const int top = amrex::min(lev, m_nlevels - 1);
+  for (int plev = 0; plev <= top; ++plev) {
+    if (m_data[plev] == nullptr) {
+      readLevel(plev);
+    }
+
+    amrex::IntVect ratio(1);
+    for (int dir = 0; dir < AMREX_SPACEDIM; dir++) {
+      ratio[dir] = geom.Domain().length(dir) / m_domain[plev].length(dir);
+    }
+    if (amrex::refine(m_domain[plev], ratio) != geom.Domain()) {
+      amrex::Abort("Quantized plotfile domain does not match the level domain");
+    }
+
+    // The last component marks the cells the plotfile level covers
+    amrex::MultiFab crse(
+      amrex::coarsen(mf.boxArray(), ratio), mf.DistributionMap(), nComp + 1,
+      0);
+    crse.setVal(0.0);
+    crse.ParallelCopy(*m_data[plev], pltComp, 0, nComp);
+    amrex::MultiFab covered(
+      m_data[plev]->boxArray(), m_data[plev]->DistributionMap(), 1, 0);
+    covered.setVal(1.0);
+    crse.ParallelCopy(covered, 0, nComp, 1);
+
+#ifdef AMREX_USE_OMP
+#pragma omp parallel if (amrex::Gpu::notInLaunchRegion())
+#endif
+    for (amrex::MFIter mfi(mf, amrex::TilingIfNotGPU()); mfi.isValid();
+         ++mfi) {
+      const amrex::Box& bx = mfi.tilebox();
+      auto const& c = crse.const_array(mfi);
+      auto const& d = mf.array(mfi);
+      amrex::ParallelFor(bx, [=] AMREX_GPU_DEVICE(int i, int j, int k) {
+        const amrex::IntVect iv(AMREX_D_DECL(i, j, k));
+        const amrex::IntVect ivc = amrex::coarsen(iv, ratio);
+        if (c(ivc, nComp) > 0.0) {
+          for (int n = 0; n < nComp; n++) {
+            d(iv, dataComp + n) = c(ivc, n);
+          }
+        }
+      });
+    }
+  }
+}
@@ -1,8 +1,11 @@
 #include <AMReX_FArrayBox.H>
+#include <AMReX_Reduce.H>
+#include <AMReX_Scan.H>
 
 #include "IndexDefines.H"
 #include "PelePhysics.H"
 #include "PeleC.H"
+#include "React.H"
 
 void
 PeleC::set_typical_values_chem()
@@ -26,6 +29,216 @@ PeleC::set_typical_values_chem()
   }
 }
 
+static bool
+react_workspace_valid(
+  const amrex::FabArrayBase& mf,
+  const amrex::BoxArray& ba,
+  const amrex::DistributionMapping& dm,
+  const int ng)
+{
+  return !mf.empty() && (mf.boxArray() == ba) &&
+         (mf.DistributionMap() == dm) && (mf.nGrow() == ng);
+}
+
+void
+PeleC::build_react_workspace(const bool need_non_react_src, const int ng)
+{
+  BL_PROFILE("PeleC::build_react_workspace()");
+
+  // for sundials box integration
+  if (!react_workspace_valid(react_STemp, grids, dmap, 0)) {
+    react_STemp.define(grids, dmap, NUM_SPECIES + 2, 0);
+    react_extsrc_rY.define(grids, dmap, NUM_SPECIES, 0);
+    react_extsrc_rE.define(grids, dmap, 1, 0);
+    react_fctCount.define(grids, dmap, 1, 0);
+    react_fctCount.setVal(0.0);
+    react_mask.define(grids, dmap, 1, 0);
+    react_mask.setVal(1);
+  }
+
+  if (
+    need_non_react_src &&
+    !react_workspace_valid(react_non_react_src, grids, dmap, ng)) {
+    react_non_react_src.define(
+      grids, dmap, NVAR, ng, amrex::MFInfo(), Factory());
+  }
+}
+
+void
+PeleC::clear_react_workspace()
+{
+  react_STemp.clear();
+  react_extsrc_rY.clear();
+  react_extsrc_rE.clear();
+  react_fctCount.clear();
+  react_mask.clear();
+  react_non_react_src.clear();
+}
+
+void
+PeleC::react_packed_cells(
+  amrex::Real* cells, const int ncells, const amrex::Real dt)
+{
+  BL_PROFILE("PeleC::react_packed_cells()");
+
+  if (ncells == 0) {
+    return;
+  }
+
+  // The reactor works on boxes, so lay the cells out along a 1D box
+  const amrex::Box pbx(
+    amrex::IntVect(0), amrex::IntVect(AMREX_D_DECL(ncells - 1, 0, 0)));
+  amrex::FArrayBox state_pack(pbx, NUM_SPECIES + 2, amrex::The_Async_Arena());
+  amrex::FArrayBox frc_pack(pbx, NUM_SPECIES + 1, amrex::The_Async_Arena());
+  amrex::FArrayBox fc_pack(pbx, 1, amrex::The_Async_Arena());
+  amrex::IArrayBox mask_pack(pbx, 1, amrex::The_Async_Arena());
+  auto const& rhoY = state_pack.array();
+  auto const& T = state_pack.array(NUM_SPECIES);
+  auto const& rhoE = state_pack.array(NUM_SPECIES + 1);
+  auto const& frcExt = frc_pack.array();
+  auto const& frcEExt = frc_pack.array(NUM_SPECIES);
+  auto const& fc = fc_pack.array();
+  auto const& mask = mask_pack.array();
+
+  amrex::ParallelFor(pbx, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
+    const amrex::Real* cell = cells + i * CPK_NCOMP;
+    for (int n = 0; n < NUM_SPECIES; n++) {
+      rhoY(i, j, k, n) = cell[CPK_RHOY + n];
+      frcExt(i, j, k, n) = cell[CPK_FRCY + n];
+    }
+    T(i, j, k) = cell[CPK_T];
+    rhoE(i, j, k) = cell[CPK_RHOE];
+    frcEExt(i, j, k) = cell[CPK_FRCE];
+    mask(i, j, k) = 1;
+  });
+
+  amrex::Real dt_react = dt;
+  amrex::Real current_time = 0.0;
+  reactor->react(
+    pbx, rhoY, frcExt, T, rhoE, frcEExt, fc, mask, dt_react, current_time
+#ifdef AMREX_USE_GPU
+    ,
+    amrex::Gpu::gpuStream()
+#endif
+  );
+
+  amrex::Gpu::Device::streamSynchronize();
+
+  amrex::ParallelFor(pbx, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
+    amrex::Real* cell = cells + i * CPK_NCOMP;
+    for (int n = 0; n < NUM_SPECIES; n++) {
+      cell[CPK_RHOY + n] = rhoY(i, j, k, n);
+    }
+    cell[CPK_T] = T(i, j, k);
+    cell[CPK_RHOE] = rhoE(i, j, k);
+    cell[CPK_FC] = fc(i, j, k);
+  });
+}
+
+void
+PeleC::react_redistributed(
+  amrex::Gpu::DeviceVector<amrex::Real>& cells, const amrex::Real dt)
+{
+  BL_PROFILE("PeleC::react_redistributed()");
+
+  const auto ncells = static_cast<int>(cells.size() / CPK_NCOMP);
+
+#ifdef AMREX_USE_MPI
+  const int nprocs = amrex::ParallelDescriptor::NProcs();
+  const int myproc = amrex::ParallelDescriptor::MyProc();
+  MPI_Comm comm = amrex::ParallelDescriptor::Communicator();
+  const auto mpi_real =
+    amrex::ParallelDescriptor::Mpi_typemap<amrex::Real>::type();
+
+  amrex::Vector<amrex::Real> h_cells(cells.size());
+  amrex::Gpu::copy(
+    amrex::Gpu::deviceToHost, cells.begin(), cells.end(), h_cells.begin());
+
+  // Predicted cost of each cell: the number of right-hand side evaluations
+  // it needed in the previous integration
+  amrex::Vector<amrex::Real> cost_sum(ncells + 1, 0.0);
+  for (int n = 0; n < ncells; n++) {
+    cost_sum[n + 1] =
+      cost_sum[n] +
+      amrex::max<amrex::Real>(1.0, h_cells[n * CPK_NCOMP + CPK_FC]);
+  }
+
+  amrex::Vector<amrex::Real> rank_cost(nprocs, 0.0);
+  MPI_Allgather(
+    &cost_sum[ncells], 1, mpi_real, rank_cost.data(), 1, mpi_real, comm);
+  amrex::Real cost_offset = 0.0;
+  amrex::Real cost_total = 0.0;
+  amrex::Real cost_max = 0.0;
+  for (int p = 0; p < nprocs; p++) {
+    if (p < myproc) {
+      cost_offset += rank_cost[p];
+    }
+    cost_total += rank_cost[p];
+    cost_max = amrex::max<amrex::Real>(cost_max, rank_cost[p]);
+  }
+  const amrex::Real cost_target = cost_total / nprocs;
+
+  // Split the global sequence of cells (ordered by rank, then by local
+  // index) into nprocs contiguous pieces of equal cost. The cells of this
+  // rank therefore go to a contiguous range of destination ranks.
+  amrex::Vector<int> send_count(nprocs, 0);
+  for (int n = 0; n < ncells; n++) {
+    int dest = myproc;
+    if (cost_target > 0.0) {
+      const amrex::Real mid =
+        cost_offset + 0.5 * (cost_sum[n] + cost_sum[n + 1]);
+      dest = amrex::min(nprocs - 1, static_cast<int>(mid / cost_target));
+    }
+    send_count[dest]++;
+  }
+  amrex::Vector<int> recv_count(nprocs, 0);
+  MPI_Alltoall(
+    send_count.data(), 1, MPI_INT, recv_count.data(), 1, MPI_INT, comm);
+
+  amrex::Vector<int> send_size(nprocs), send_displ(nprocs);
+  amrex::Vector<int> recv_size(nprocs), recv_displ(nprocs);
+  int nrecv = 0;
+  for (int p = 0; p < nprocs; p++) {
+    send_size[p] = send_count[p] * CPK_NCOMP;
+    recv_size[p] = recv_count[p] * CPK_NCOMP;
+    send_displ[p] = (p == 0) ? 0 : send_displ[p - 1] + send_size[p - 1];
+    recv_displ[p] = (p == 0) ? 0 : recv_displ[p - 1] + recv_size[p - 1];
+    nrecv += recv_count[p];
+  }
+
+  amrex::Vector<amrex::Real> h_recv(
+    static_cast<std::size_t>(nrecv) * CPK_NCOMP);
+  MPI_Alltoallv(
+    h_cells.data(), send_size.data(), send_displ.data(), mpi_real,
+    h_recv.data(), recv_size.data(), recv_displ.data(), mpi_real, comm);
+
+  amrex::Gpu::DeviceVector<amrex::Real> recv_cells(h_recv.size());
+  amrex::Gpu::copy(
+    amrex::Gpu::hostToDevice, h_recv.begin(), h_recv.end(),
+    recv_cells.begin());
+  react_packed_cells(recv_cells.data(), nrecv, dt);
+  amrex::Gpu::copy(
+    amrex::Gpu::deviceToHost, recv_cells.begin(), recv_cells.end(),
+    h_recv.begin());
+
+  // Return the integrated cells to their owners, in their original order
+  MPI_Alltoallv(
+    h_recv.data(), recv_size.data(), recv_displ.data(), mpi_real,
+    h_cells.data(), send_size.data(), send_displ.data(), mpi_real, comm);
+  amrex::Gpu::copy(
+    amrex::Gpu::hostToDevice, h_cells.begin(), h_cells.end(), cells.begin());
+
+  if (verbose > 1) {
+    amrex::Print() << "... Chemistry redistributed at level " << level
+                   << ": max/mean predicted cost per rank "
+                   << (cost_target > 0.0 ? cost_max / cost_target : 1.0)
+                   << " before balancing" << std::endl;
+  }
+#else
+  react_packed_cells(cells.data(), ncells, dt);
+#endif
+}
+
 void
 PeleC::react_state(
   amrex::Real /*time*/,
@@ -54,11 +267,11 @@ PeleC::react_state(
   prefetchToDevice(S_new);
 
   // Create a MultiFab with all of the non-reacting source terms.
-  amrex::MultiFab non_react_src_tmp;
+  build_react_workspace(react_init || (aux_src == nullptr), ng);
+  amrex::MultiFab& non_react_src_tmp = react_non_react_src;
   amrex::MultiFab* non_react_src = nullptr;
 
   if (react_init) {
-    non_react_src_tmp.define(grids, dmap, NVAR, ng, amrex::MFInfo(), Factory());
     non_react_src_tmp.setVal(0);
     non_react_src = &non_react_src_tmp;
   } else {
@@ -66,20 +279,22 @@ PeleC::react_state(
     // Build non-reacting source term, and an S_new that does not include
     // reactions
     if (aux_src == nullptr) {
-      non_react_src_tmp.define(
-        grids, dmap, NVAR, ng, amrex::MFInfo(), Factory());
-      non_react_src_tmp.setVal(0);
       non_react_src = &non_react_src_tmp;
 
+      amrex::Vector<StateUpdateTerm> terms;
       for (int n = 0; n < src_list.size(); ++n) {
-        amrex::MultiFab::Saxpy(
-          non_react_src_tmp, 0.5, *new_sources[src_list[n]], 0, 0, NVAR, ng);
-        amrex::MultiFab::Saxpy(
-          non_react_src_tmp, 0.5, *old_sources[src_list[n]], 0, 0, NVAR, ng);
+        terms.push_back({new_sources[src_list[n]].get(), 0.5, 0, 0, NVAR});
+        terms.push_back({old_sources[src_list[n]].get(), 0.5, 0, 0, NVAR});
       }
 
       if (do_hydro && !do_mol) {
-        amrex::MultiFab::Add(non_react_src_tmp, hydro_source, 0, 0, NVAR, ng);
+        terms.push_back({&hydro_source, 1.0, 0, 0, NVAR});
+      }
+
+      if (terms.empty()) {
+        non_react_src_tmp.setVal(0);
+      } else {
+        fused_state_update(non_react_src_tmp, terms, ng, false);
       }
     } else {
       // in MOL update all non-reacting sources
@@ -89,21 +304,33 @@ PeleC::react_state(
 
     // S_new = S_old + dt*(non reacting source terms)
     const amrex::MultiFab& S_old = get_old_data(State_Type);
-    amrex::MultiFab::Copy(S_new, S_old, 0, 0, NVAR, ng);
-    amrex::MultiFab::Saxpy(S_new, dt, *non_react_src, 0, 0, NVAR, ng);
+    fused_state_update(
+      S_new, {{&S_old, 1.0, 0, 0, NVAR}, {non_react_src, dt, 0, 0, NVAR}}, ng,
+      false);
   }
 
+  // The chemistry pre-screen needs the reaction source of the previous step
+  // (or SDC iteration), which is overwritten tile by tile below
+  const bool screen_cells = chem_skip && !react_init;
+  const amrex::Real T_skip_min = chem_skip_T_min;
+  const amrex::Real T_skip_max = chem_skip_T_max;
+  const amrex::Real src_skip_tol = chem_skip_src_tol;
+  const amrex::Real IR_skip_tol = chem_skip_IR_tol;
+  amrex::Long n_cells_screened = 0;
+  amrex::Long n_cells_skipped = 0;
+
   amrex::MultiFab& react_src = get_new_data(Reactions_Type);
-  react_src.setVal(0.0);
+  if (!screen_cells) {
+    react_src.setVal(0.0);
+  }
   prefetchToDevice(react_src);
 
   // for sundials box integration
-  amrex::MultiFab STemp(grids, dmap, NUM_SPECIES + 2, 0);
-  amrex::MultiFab extsrc_rY(grids, dmap, NUM_SPECIES, 0);
-  amrex::MultiFab extsrc_rE(grids, dmap, 1, 0);
-  amrex::iMultiFab dummyMask(grids, dmap, 1, 0);
-  amrex::MultiFab fctCount(grids, dmap, 1, 0);
-  dummyMask.setVal(1);
+  amrex::MultiFab& STemp = react_STemp;
+  amrex::MultiFab& extsrc_rY = react_extsrc_rY;
+  amrex::MultiFab& extsrc_rE = react_extsrc_rE;
+  amrex::iMultiFab& dummyMask = react_mask;
+  amrex::MultiFab& fctCount = react_fctCount;
 
   if (!react_init) {
     const amrex::MultiFab& S_old = get_old_data(State_Type);
@@ -124,8 +351,23 @@ PeleC::react_state(
     dynamic_cast<amrex::EBFArrayBoxFactory const&>(S_new.Factory());
   auto const& flags = fact.getMultiEBCellFlagFab();
 
+  // only update beyond first step
+  // TODO: Update here? Or just get reaction source?
+  const bool do_update = !react_init;
+
+  // When the chemistry is redistributed, the cells of all tiles are packed
+  // into one buffer and integrated after the loop over tiles. The tiles are
+  // then visited again, in the same order, to unpack the results.
+  const bool balance_cells =
+    chem_redistribute && (amrex::ParallelDescriptor::NProcs() > 1);
+  amrex::Gpu::DeviceVector<amrex::Real> balance_pack;
+  amrex::Vector<amrex::Gpu::DeviceVector<int>> balance_tile_cells;
+  amrex::Vector<int> balance_tile_offset;
+  amrex::Vector<amrex::Real> balance_tile_time;
+
 #ifdef AMREX_USE_OMP
-#pragma omp parallel if (amrex::Gpu::notInLaunchRegion())
+#pragma omp parallel if (amrex::Gpu::notInLaunchRegion() && !balance_cells)   \
+  reduction(+ : n_cells_screened, n_cells_skipped)
 #endif
   {
     for (amrex::MFIter mfi(S_new, amrex::TilingIfNotGPU()); mfi.isValid();
@@ -142,13 +384,12 @@ PeleC::react_state(
       auto const& nonrs_arr = non_react_src->array(mfi);
       auto const& I_R = react_src.array(mfi);
 
-      // only update beyond first step
-      // TODO: Update here? Or just get reaction source?
-      const bool do_update = !react_init;
-
       const auto& flag_fab = flags[mfi];
       amrex::FabType typ = flag_fab.getType(bx);
       if (typ == amrex::FabType::covered) {
+        if (screen_cells) {
+          react_src[mfi].setVal<amrex::RunOn::Device>(0.0, bx);
+        }
         if (do_react_load_balance) {
           const amrex::Box vbox = mfi.tilebox();
           get_new_data(Work_Estimate_Type)[mfi].plus<amrex::RunOn::Device>(
@@ -202,87 +443,136 @@ PeleC::react_state(
             frcEExt(i, j, k) = rhoedot_ext;
           });
 
-        reactor->react(
-          bx, rhoY, frcExt, T, rhoE, frcEExt, fc, mask, dt, current_time
+        if (screen_cells || balance_cells) {
+          amrex::IArrayBox active_fab(bx, 1, amrex::The_Async_Arena());
+          auto const& active = active_fab.array();
+
+          if (screen_cells) {
+            // Classify the cells: only those inside the temperature window
+            // and with a non-negligible non-reacting or previous reaction
+            // source are integrated
+            amrex::ParallelFor(
+              bx, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
+                const amrex::Real Temp = T(i, j, k);
+                amrex::Real src_norm = 0.0;
+                amrex::Real IR_norm = 0.0;
+                for (int nsp = 0; nsp < NUM_SPECIES; nsp++) {
+                  src_norm += std::abs(frcExt(i, j, k, nsp));
+                  IR_norm += std::abs(I_R(i, j, k, nsp));
+                }
+                const amrex::Real scale = dt / sold_arr(i, j, k, URHO);
+                active(i, j, k) =
+                  static_cast<int>(
+                    (Temp >= T_skip_min) && (Temp <= T_skip_max) &&
+                    ((src_norm * scale > src_skip_tol) ||
+                     (IR_norm * scale > IR_skip_tol)));
+              });
+
+            // Inactive cells: advance with the previous reaction source
+            // frozen and recover the temperature from the updated internal
+            // energy
+            amrex::ParallelFor(
+              bx, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
+                if (active(i, j, k) == 0) {
+                  amrex::Real rho = 0.0;
+                  for (int nsp = 0; nsp < NUM_SPECIES; nsp++) {
+                    rhoY(i, j, k, nsp) +=
+                      dt * (frcExt(i, j, k, nsp) + I_R(i, j, k, nsp));
+                    rho += rhoY(i, j, k, nsp);
+                  }
+                  rhoE(i, j, k) += dt * frcEExt(i, j, k);
+                  const amrex::Real rhoInv = 1.0 / rho;
+                  amrex::Real massfrac[NUM_SPECIES] = {0.0};
+                  for (int nsp = 0; nsp < NUM_SPECIES; nsp++) {
+                    massfrac[nsp] = rhoY(i, j, k, nsp) * rhoInv;
+                  }
+                  amrex::Real e = rhoE(i, j, k) * rhoInv;
+                  amrex::Real Temp = T(i, j, k);
+                  auto eos = pele::physics::PhysicsType::eos();
+                  eos.REY2T(rho, e, massfrac, Temp);
+                  T(i, j, k) = Temp;
+                  fc(i, j, k) = 0.0;
+                }
+              });
+          } else {
+            active_fab.setVal<amrex::RunOn::Device>(1);
+          }
+
+          // Gather the active cells into a compact list
+          const auto ncells = static_cast<int>(bx.numPts());
+          amrex::Gpu::DeviceVector<int> active_cells(ncells);
+          int* p_cells = active_cells.data();
+          const int nactive = amrex::Scan::PrefixSum<int>(
+            ncells,
+            [=] AMREX_GPU_DEVICE(int icell) -> int {
+              return active(bx.atOffset(icell));
+            },
+            [=] AMREX_GPU_DEVICE(int icell, int const& x) {
+              if (active(bx.atOffset(icell)) != 0) {
+                p_cells[x] = icell;
+              }
+            },
+            amrex::Scan::Type::exclusive, amrex::Scan::retSum);
+
+          n_cells_screened += ncells;
+          n_cells_skipped += ncells - nactive;
+
+          // Pack them for the reactor
+          amrex::Gpu::DeviceVector<amrex::Real> local_pack;
+          amrex::Real* p_pack = nullptr;
+          if (balance_cells) {
+            // growing the buffer may move the cells packed so far
+            amrex::Gpu::streamSynchronize();
+            const auto offset =
+              static_cast<int>(balance_pack.size() / CPK_NCOMP);
+            balance_pack.resize(
+              static_cast<std::size_t>(offset + nactive) * CPK_NCOMP);
+            p_pack = balance_pack.data() + offset * CPK_NCOMP;
+            balance_tile_offset.push_back(offset);
+          } else {
+            local_pack.resize(static_cast<std::size_t>(nactive) * CPK_NCOMP);
+            p_pack = local_pack.data();
+          }
+          amrex::ParallelFor(nactive, [=] AMREX_GPU_DEVICE(int n) noexcept {
+            pc_chem_pack_cell(
+              bx.atOffset(p_cells[n]), rhoY, T, rhoE, frcExt, frcEExt, fc,
+              p_pack + n * CPK_NCOMP);
+          });
+
+          if (balance_cells) {
+            // Integrated and unpacked once all ranks have packed their cells
+            balance_tile_cells.push_back(std::move(active_cells));
+            balance_tile_time.push_back(
+              (amrex::ParallelDescriptor::second() - wt) / bx.d_numPts());
+            continue;
+          }
+
+          react_packed_cells(p_pack, nactive, dt);
+
+          amrex::ParallelFor(nactive, [=] AMREX_GPU_DEVICE(int n) noexcept {
+            pc_chem_unpack_cell(
+              bx.atOffset(p_cells[n]), p_pack + n * CPK_NCOMP, rhoY, T, rhoE,
+              fc);
+          });
+          amrex::Gpu::streamSynchronize();
+        } else {
+          reactor->react(
+            bx, rhoY, frcExt, T, rhoE, frcEExt, fc, mask, dt, current_time
 #ifdef AMREX_USE_GPU
-          ,
-          amrex::Gpu::gpuStream()
+            ,
+            amrex::Gpu::gpuStream()
 #endif
-        );
+          );
 
-        amrex::Gpu::Device::streamSynchronize();
+          amrex::Gpu::Device::streamSynchronize();
+        }
 
         // unpack data
         amrex::ParallelFor(
           bx, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
-            // work on old state
-            amrex::Real rhou = sold_arr(i, j, k, UMX);
-            amrex::Real rhov = sold_arr(i, j, k, UMY);
-            amrex::Real rhow = sold_arr(i, j, k, UMZ);
-            amrex::Real rho_old = sold_arr(i, j, k, URHO);
-            amrex::Real rhoInv = 1.0 / rho_old;
-
-            amrex::Real e_old =
-              (sold_arr(i, j, k, UEDEN) // old total energy
-               - 0.5 * (rhou * rhou + rhov * rhov + rhow * rhow) * rhoInv) // KE
-              * rhoInv;
-
-            rhou = snew_arr(i, j, k, UMX);
-            rhov = snew_arr(i, j, k, UMY);
-            rhow = snew_arr(i, j, k, UMZ);
-            rhoInv = 1.0 / snew_arr(i, j, k, URHO);
-
-            amrex::Real rhoedot_ext =
-              (snew_arr(i, j, k, UEDEN) // new total energy
-               - 0.5 * (rhou * rhou + rhov * rhov + rhow * rhow) * rhoInv // KE
-               - rho_old * e_old) // old internal energy
-              / dt;
-
-            amrex::Real umnew =
-              sold_arr(i, j, k, UMX) + dt * nonrs_arr(i, j, k, UMX);
-            amrex::Real vmnew =
-              sold_arr(i, j, k, UMY) + dt * nonrs_arr(i, j, k, UMY);
-            amrex::Real wmnew =
-              sold_arr(i, j, k, UMZ) + dt * nonrs_arr(i, j, k, UMZ);
-
-            // get new rho
-            amrex::Real rhonew = 0.0;
-
-            for (int nsp = 0; nsp < NUM_SPECIES; nsp++) {
-              rhonew += rhoY(i, j, k, nsp);
-            }
-
-            if (do_update) {
-              snew_arr(i, j, k, URHO) = rhonew;
-              snew_arr(i, j, k, UMX) = umnew;
-              snew_arr(i, j, k, UMY) = vmnew;
-              snew_arr(i, j, k, UMZ) = wmnew;
-
-              for (int nsp = 0; nsp < NUM_SPECIES; nsp++) {
-                snew_arr(i, j, k, UFS + nsp) = rhoY(i, j, k, nsp);
-              }
-              snew_arr(i, j, k, UTEMP) = T(i, j, k);
-
-              snew_arr(i, j, k, UEINT) = rho_old * e_old + dt * rhoedot_ext;
-              snew_arr(i, j, k, UEDEN) =
-                snew_arr(i, j, k, UEINT) +
-                0.5 * (umnew * umnew + vmnew * vmnew + wmnew * wmnew) / rhonew;
-            }
-
-            for (int nsp = 0; nsp < NUM_SPECIES; nsp++) {
-              I_R(i, j, k, nsp) = (rhoY(i, j, k, nsp)              // new rhoy
-                                   - sold_arr(i, j, k, UFS + nsp)) // old rhoy
-                                    / dt -
-                                  nonrs_arr(i, j, k, UFS + nsp);
-            }
-
-            I_R(i, j, k, NUM_SPECIES) =
-              (rho_old * e_old + dt * rhoedot_ext // new internal energy
-               + 0.5 * (umnew * umnew + vmnew * vmnew + wmnew * wmnew) /
-                   rhonew                  // new KE
-               - sold_arr(i, j, k, UEDEN)) // old total energy
-                / dt -
-              nonrs_arr(i, j, k, UEDEN);
+            pc_react_update(
+              i, j, k, sold_arr, snew_arr, nonrs_arr, I_R, rhoY, T, dt,
+              do_update);
           });
 
         wt = (amrex::ParallelDescriptor::second() - wt) / bx.d_numPts();
@@ -296,31 +586,123 @@ PeleC::react_state(
         // update heat release
         amrex::ParallelFor(
           bx, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
-            I_R(i, j, k, NUM_SPECIES + 1) = 0.0;
-            auto eos = pele::physics::PhysicsType::eos();
-
-            amrex::Real hi[NUM_SPECIES] = {0.0};
-
-            amrex::Real Yspec[NUM_SPECIES] = {0.0};
-            for (int nsp = 0; nsp < NUM_SPECIES; nsp++) {
-              Yspec[nsp] =
-                snew_arr(i, j, k, UFS + nsp) / snew_arr(i, j, k, URHO);
-            }
-            eos.RTY2Hi(
-              snew_arr(i, j, k, URHO), snew_arr(i, j, k, UTEMP), Yspec, hi);
-
-            for (int nsp = 0; nsp < NUM_SPECIES; nsp++) {
-              I_R(i, j, k, NUM_SPECIES + 1) -= hi[nsp] * I_R(i, j, k, nsp);
-            }
+            pc_react_heat_release(i, j, k, snew_arr, I_R);
           });
       }
     }
   }
 
+  if (balance_cells) {
+    const amrex::Real react_strt = amrex::ParallelDescriptor::second();
+    react_redistributed(balance_pack, dt);
+
+    // The cells were integrated on other ranks, so the cost of each cell is
+    // estimated from its right-hand side evaluations, at the average time
+    // per evaluation over all ranks
+    amrex::Real time_per_fc = 0.0;
+    if (do_react_load_balance) {
+      const amrex::Real* p_all = balance_pack.data();
+      amrex::Real totals[2] = {
+        amrex::ParallelDescriptor::second() - react_strt,
+        amrex::Reduce::Sum<amrex::Real>(
+          static_cast<int>(balance_pack.size() / CPK_NCOMP),
+          [=] AMREX_GPU_DEVICE(int n) noexcept {
+            return amrex::max<amrex::Real>(
+              1.0, p_all[n * CPK_NCOMP + CPK_FC]);
+          })};
+      amrex::ParallelDescriptor::ReduceRealSum(totals, 2);
+      time_per_fc = (totals[1] > 0.0) ? totals[0] / totals[1] : 0.0;
+    }
+
+    // Unpack the results, visiting the tiles in the same order as above
+    int itile = 0;
+    for (amrex::MFIter mfi(S_new, amrex::TilingIfNotGPU()); mfi.isValid();
+         ++mfi) {
+      const amrex::Box& bx = mfi.growntilebox(ng);
+      const amrex::FabType typ = flags[mfi].getType(bx);
+      if (
+        (typ != amrex::FabType::singlevalued) &&
+        (typ != amrex::FabType::regular)) {
+        continue;
+      }
+
+      auto const& sold_arr =
+        react_init ? S_new.array(mfi) : get_old_data(State_Type).array(mfi);
+      auto const& snew_arr = S_new.array(mfi);
+      auto const& nonrs_arr = non_react_src->array(mfi);
+      auto const& I_R = react_src.array(mfi);
+      auto const& rhoY = STemp.array(mfi);
+      auto const& T = STemp.array(mfi, NUM_SPECIES);
+      auto const& rhoE = STemp.array(mfi, NUM_SPECIES + 1);
+      auto const& fc = fctCount.array(mfi);
+
+      const int* p_cells = balance_tile_cells[itile].data();
+      const amrex::Real* p_pack =
+        balance_pack.data() + balance_tile_offset[itile] * CPK_NCOMP;
+      const int nactive =
+        (itile + 1 < balance_tile_offset.size()
+           ? balance_tile_offset[itile + 1]
+           : static_cast<int>(balance_pack.size() / CPK_NCOMP)) -
+        balance_tile_offset[itile];
+      const amrex::Real tile_time = balance_tile_time[itile];
+      itile++;
+
+      amrex::ParallelFor(nactive, [=] AMREX_GPU_DEVICE(int n) noexcept {
+        pc_chem_unpack_cell(
+          bx.atOffset(p_cells[n]), p_pack + n * CPK_NCOMP, rhoY, T, rhoE, fc);
+      });
+
+      amrex::ParallelFor(
+        bx, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
+          pc_react_update(
+            i, j, k, sold_arr, snew_arr, nonrs_arr, I_R, rhoY, T, dt,
+            do_update);
+        });
+
+      amrex::ParallelFor(
+        bx, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
+          pc_react_heat_release(i, j, k, snew_arr, I_R);
+        });
+
+      if (do_react_load_balance) {
+        // Local work per cell of the tile, plus the integration cost of
+        // each of its active cells
+        const amrex::Box vbox = mfi.tilebox();
+        auto const& wgt = get_new_data(Work_Estimate_Type).array(mfi);
+        amrex::ParallelFor(
+          vbox, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
+            wgt(i, j, k) += tile_time;
+          });
+        amrex::ParallelFor(nactive, [=] AMREX_GPU_DEVICE(int n) noexcept {
+          const amrex::IntVect iv = bx.atOffset(p_cells[n]);
+          if (vbox.contains(iv)) {
+            wgt(iv) += time_per_fc * amrex::max<amrex::Real>(1.0, fc(iv));
+          }
+        });
+      }
+    }
+    amrex::Gpu::streamSynchronize();
+  }
+
   if (ng > 0) {
     S_new.FillBoundary(geom.periodicity());
   }
 
+  if (screen_cells && (verbose != 0)) {
+    amrex::Long counts[2] = {n_cells_screened, n_cells_skipped};
+    amrex::ParallelDescriptor::ReduceLongSum(
+      counts, 2, amrex::ParallelDescriptor::IOProcessorNumber());
+    if (amrex::ParallelDescriptor::IOProcessor()) {
+      const amrex::Real skip_frac =
+        counts[0] > 0 ? static_cast<amrex::Real>(counts[1]) /
+                          static_cast<amrex::Real>(counts[0])
+                      : 0.0;
+      amrex::Print() << "... Chemistry skipped in " << counts[1] << " of "
+                     << counts[0] << " cells (fraction " << skip_frac
+                     << ") at level " << level << std::endl;
+    }
+  }
+
   if (verbose > 1) {
     const int IOProc = amrex::ParallelDescriptor::IOProcessorNumber();
     amrex::Real run_time = amrex::ParallelDescriptor::second() - strt_time;
@@ -41,6 +41,19 @@ static int react_src_bc[] = {INT_DIR,      REFLECT_EVEN, REFLECT_EVEN,
                              REFLECT_EVEN, REFLECT_EVEN, REFLECT_EVEN,
                              REFLECT_EVEN};
 
+// Velocity fluctuations of the turbulent inflow on a boundary plane
+static void
+pc_turb_inflow_plane(
+  const amrex::Box& plane,
+  amrex::FArrayBox& fab,
+  const amrex::Geometry& geom,
+  const amrex::Real time,
+  const amrex::Orientation face)
+{
+  PeleC::turb_inflow.add_turb(
+    plane, fab, 0, geom, time, face.coordDir(), face.faceDir());
+}
+
 static void
 set_scalar_bc(amrex::BCRec& bc, const amrex::BCRec& phys_bc)
 {
@@ -156,6 +169,13 @@ PeleC::variableSetUp()
   eb_in_domain = ebInDomain();
   read_params();
 
+  time_bcfill_hyp = (verbose > 0);
+  turb_inflow_planes.set_caching(bndry_plane_cache);
+  prob_inflow_planes.set_caching(bndry_plane_cache);
+  if (turb_inflow.is_initialized()) {
+    turb_inflow_planes.set_fill(pc_turb_inflow_plane);
+  }
+
 #ifdef PELEC_USE_MASA
   if (do_mms) {
     init_mms();
@@ -641,6 +661,8 @@ PeleC::variableCleanUp()
   clear_prob();
 
   eb_initialized = false;
+  turb_inflow_planes.clear();
+  prob_inflow_planes.clear();
 
   delete prob_parm_host;
   delete tagging_parm;
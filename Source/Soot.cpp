@@ -55,7 +55,17 @@ PeleC::construct_old_soot_source(amrex::Real time, amrex::Real dt)
 
   int ng = 0; // None filled
 
-  PeleC::fill_soot_source(time, dt, S_old, *old_sources[soot_src], ng);
+  // Reuse the primitive state if Sborder was filled from this state
+  const amrex::MultiFab* q_cache = nullptr;
+  const amrex::MultiFab* coeff_cache = nullptr;
+  if (primitive_cache_matches(time, ng)) {
+    build_primitive_cache(Sborder, ng, true);
+    q_cache = &prim_q;
+    coeff_cache = &prim_coeff;
+  }
+
+  PeleC::fill_soot_source(
+    time, dt, S_old, *old_sources[soot_src], ng, q_cache, coeff_cache);
 
   old_sources[soot_src]->FillBoundary(geom.periodicity());
 }
@@ -71,7 +81,16 @@ PeleC::construct_new_soot_source(amrex::Real time, amrex::Real dt)
 
   int ng = 0;
 
-  PeleC::fill_soot_source(time, dt, S_new, *new_sources[soot_src], ng);
+  const amrex::MultiFab* q_cache = nullptr;
+  const amrex::MultiFab* coeff_cache = nullptr;
+  if (primitive_cache_matches(time, ng)) {
+    build_primitive_cache(Sborder, ng, true);
+    q_cache = &prim_q;
+    coeff_cache = &prim_coeff;
+  }
+
+  PeleC::fill_soot_source(
+    time, dt, S_new, *new_sources[soot_src], ng, q_cache, coeff_cache);
 }
 
 void
@@ -80,7 +99,9 @@ PeleC::fill_soot_source(
   amrex::Real dt,
   amrex::MultiFab& state,
   amrex::MultiFab& soot_src,
-  int ng)
+  int ng,
+  const amrex::MultiFab* q_cache,
+  const amrex::MultiFab* coeff_cache)
 {
   BL_PROFILE("PeleC::fill_soot_source()");
 
@@ -104,53 +125,66 @@ PeleC::fill_soot_source(
     amrex::FArrayBox& soot_fab = soot_src[mfi];
     auto const& s_arr = Sfab.array();
     const int nqaux = NQAUX > 0 ? NQAUX : 1;
-    amrex::FArrayBox mu_cc(bx, 1, amrex::The_Async_Arena());
-    amrex::FArrayBox q(bx, QVAR, amrex::The_Async_Arena());
-    amrex::FArrayBox qaux(bx, nqaux, amrex::The_Async_Arena());
-    auto const& q_arr = q.array();
-    auto const& qaux_arr = qaux.array();
-    auto const& mu_arr = mu_cc.array();
-
-    // Get primitives, Q, including (Y, T, p, rho) from conserved state
-    // required for D term
-    {
-      BL_PROFILE("PeleC::ctoprim()");
-      amrex::ParallelFor(
-        bx, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
-          pc_ctoprim(i, j, k, s_arr, q_arr, qaux_arr);
-        });
-    }
+    amrex::FArrayBox mu_cc;
+    amrex::FArrayBox q;
+    amrex::FArrayBox qaux;
+    amrex::Array4<const amrex::Real> q_arr;
+    amrex::Array4<const amrex::Real> mu_arr;
+    if (q_cache != nullptr) {
+      // Primitives and viscosity already computed from this state
+      q_arr = q_cache->const_array(mfi);
+      mu_arr = (*coeff_cache)[mfi].const_array(dComp_mu);
+    } else {
+      mu_cc.resize(bx, 1, amrex::The_Async_Arena());
+      q.resize(bx, QVAR, amrex::The_Async_Arena());
+      qaux.resize(bx, nqaux, amrex::The_Async_Arena());
+      auto const& q_ar = q.array();
+      auto const& qaux_ar = qaux.array();
+      auto const& mu_ar = mu_cc.array();
+
+      // Get primitives, Q, including (Y, T, p, rho) from conserved state
+      // required for D term
+      {
+        BL_PROFILE("PeleC::ctoprim()");
+        amrex::ParallelFor(
+          bx, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
+            pc_ctoprim(i, j, k, s_arr, q_ar, qaux_ar);
+          });
+      }
 
-    // Compute transport coefficients, coincident with Q
-    {
-      auto const& qar_yin = q.array(QFS);
-      auto const& qar_Tin = q.array(QTEMP);
-      auto const& qar_rhoin = q.array(QRHO);
-      bool get_xi = false;
-      bool get_mu = true;
-      bool get_lam = false;
-      bool get_diag = false;
-      bool get_chi = false;
-      BL_PROFILE("PeleC::get_transport_coeffs()");
-      // Get Transport coefs on GPU.
-      auto const* ltransparm = trans_parms.device_trans_parm();
-      amrex::ParallelFor(
-        bx, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
-          auto trans = pele::physics::PhysicsType::transport();
-          amrex::Real T = qar_Tin(i, j, k);
-          amrex::Real rho = qar_rhoin(i, j, k);
-          amrex::GpuArray<amrex::Real, NUM_SPECIES> Y = {{0.0}};
-          for (int n = 0; n < NUM_SPECIES; ++n) {
-            Y[n] = qar_yin(i, j, k, n);
-          }
-          amrex::Real* diag = nullptr;
-          amrex::Real mu = 0.;
-          amrex::Real xi, lam;
-          trans.transport(
-            get_xi, get_mu, get_lam, get_diag, get_chi, T, rho, Y.data(), diag,
-            nullptr, mu, xi, lam, ltransparm);
-          mu_arr(i, j, k) = mu;
-        });
+      // Compute transport coefficients, coincident with Q
+      {
+        auto const& qar_yin = q.array(QFS);
+        auto const& qar_Tin = q.array(QTEMP);
+        auto const& qar_rhoin = q.array(QRHO);
+        bool get_xi = false;
+        bool get_mu = true;
+        bool get_lam = false;
+        bool get_diag = false;
+        bool get_chi = false;
+        BL_PROFILE("PeleC::get_transport_coeffs()");
+        // Get Transport coefs on GPU.
+        auto const* ltransparm = trans_parms.device_trans_parm();
+        amrex::ParallelFor(
+          bx, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
+            auto trans = pele::physics::PhysicsType::transport();
+            amrex::Real T = qar_Tin(i, j, k);
+            amrex::Real rho = qar_rhoin(i, j, k);
+            amrex::GpuArray<amrex::Real, NUM_SPECIES> Y = {{0.0}};
+            for (int n = 0; n < NUM_SPECIES; ++n) {
+              Y[n] = qar_yin(i, j, k, n);
+            }
+            amrex::Real* diag = nullptr;
+            amrex::Real mu = 0.;
+            amrex::Real xi, lam;
+            trans.transport(
+              get_xi, get_mu, get_lam, get_diag, get_chi, T, rho, Y.data(),
+              diag, nullptr, mu, xi, lam, ltransparm);
+            mu_ar(i, j, k) = mu;
+          });
+      }
+      q_arr = q_ar;
+      mu_arr = mu_ar;
     }
     auto const& soot_arr = soot_fab.array();
     soot_model.computeSootSourceTerm(bx, q_arr, mu_arr, soot_arr, time, dt);
@@ -15,50 +15,30 @@ PeleC::sum_integrated_quantities()
 
   int finest_level = parent->finestLevel();
   amrex::Real time = state[State_Type].curTime();
-  amrex::Real mass = 0.0;
-  amrex::Real mom[3] = {0.0};
-  amrex::Real rho_e = 0.0;
-  amrex::Real rho_K = 0.0;
-  amrex::Real rho_E = 0.0;
-  amrex::Real fuel_prod = 0;
-  amrex::Real temp = 0;
+  amrex::Real foo[num_iq] = {0.0};
 
+  // Each level is integrated in one fused pass; the MPI reduction is done
+  // once for all quantities and levels
   for (int lev = 0; lev <= finest_level; lev++) {
     PeleC& pc_lev = getLevel(lev);
-
-    mass += pc_lev.volWgtSum("density", time, local_flag);
-    mom[0] += pc_lev.volWgtSum("xmom", time, local_flag);
-    mom[1] += pc_lev.volWgtSum("ymom", time, local_flag);
-    mom[2] += pc_lev.volWgtSum("zmom", time, local_flag);
-    rho_e += pc_lev.volWgtSum("rho_e", time, local_flag);
-    rho_K += pc_lev.volWgtSum("kineng", time, local_flag);
-    rho_E += pc_lev.volWgtSum("rho_E", time, local_flag);
-
-    if (!fuel_name.empty()) {
-      fuel_prod += pc_lev.volWgtSum("rho_omega_" + fuel_name, time, local_flag);
+    const auto sums = pc_lev.volWgtSumIntegrated(local_flag);
+    for (int n = 0; n < num_iq; n++) {
+      foo[n] += sums[n];
     }
-
-    temp += pc_lev.volWgtSum("Temp", time, local_flag);
   }
 
   if (verbose > 0) {
-    const int nfoo = 10;
-    amrex::Real foo[nfoo] = {mass,  mom[0], mom[1],    mom[2], rho_e,
-                             rho_K, rho_E,  fuel_prod, temp};
     amrex::ParallelDescriptor::ReduceRealSum(
-      foo, nfoo, amrex::ParallelDescriptor::IOProcessorNumber());
+      foo, num_iq, amrex::ParallelDescriptor::IOProcessorNumber());
 
     if (amrex::ParallelDescriptor::IOProcessor()) {
-      int i = 0;
-      mass = foo[i++];
-      mom[0] = foo[i++];
-      mom[1] = foo[i++];
-      mom[2] = foo[i++];
-      rho_e = foo[i++];
-      rho_K = foo[i++];
-      rho_E = foo[i++];
-      fuel_prod = foo[i++];
-      temp = foo[i++];
+      const amrex::Real mass = foo[iq_mass];
+      const amrex::Real mom[3] = {foo[iq_xmom], foo[iq_ymom], foo[iq_zmom]};
+      const amrex::Real rho_e = foo[iq_rho_e];
+      const amrex::Real rho_K = foo[iq_rho_K];
+      const amrex::Real rho_E = foo[iq_rho_E];
+      const amrex::Real fuel_prod = foo[iq_fuel_prod];
+      const amrex::Real temp = foo[iq_temp];
 
       amrex::Print() << '\n';
       amrex::Print() << "TIME = " << time << " MASS        = " << mass << '\n';
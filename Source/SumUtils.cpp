@@ -143,6 +143,103 @@ PeleC::volWgtSumMF(
   return sum;
 }
 
+amrex::GpuArray<amrex::Real, num_iq>
+PeleC::volWgtSumIntegrated(bool local, bool finemask)
+{
+  BL_PROFILE("PeleC::volWgtSumIntegrated()");
+
+  // Evaluate every integrand of sum_integrated_quantities in one pass over
+  // the new state, applying the fine mask, volume fraction and cell volume
+  // inline rather than deriving, masking and reducing a temporary MultiFab
+  // for each quantity
+  const amrex::MultiFab& S = get_new_data(State_Type);
+  const amrex::MultiFab& R = get_new_data(Reactions_Type);
+
+  int fuel_comp = -1;
+  if (!fuel_name.empty()) {
+    for (int n = 0; n < NUM_SPECIES; n++) {
+      if (spec_names[n] == fuel_name) {
+        fuel_comp = n;
+      }
+    }
+    if (fuel_comp < 0) {
+      amrex::Abort("volWgtSumIntegrated: unknown fuel_name " + fuel_name);
+    }
+  }
+
+  const bool use_mask = (level < parent->finestLevel()) && finemask;
+  const amrex::MultiFab* mask =
+    use_mask ? &(getLevel(level + 1).build_fine_mask()) : nullptr;
+  const bool use_vfrac = eb_in_domain;
+
+  amrex::ReduceOps<
+    amrex::ReduceOpSum, amrex::ReduceOpSum, amrex::ReduceOpSum,
+    amrex::ReduceOpSum, amrex::ReduceOpSum, amrex::ReduceOpSum,
+    amrex::ReduceOpSum, amrex::ReduceOpSum, amrex::ReduceOpSum>
+    reduce_op;
+  amrex::ReduceData<
+    amrex::Real, amrex::Real, amrex::Real, amrex::Real, amrex::Real,
+    amrex::Real, amrex::Real, amrex::Real, amrex::Real>
+    reduce_data(reduce_op);
+  using ReduceTuple = typename decltype(reduce_data)::Type;
+
+#ifdef AMREX_USE_OMP
+#pragma omp parallel if (amrex::Gpu::notInLaunchRegion())
+#endif
+  for (amrex::MFIter mfi(S, amrex::TilingIfNotGPU()); mfi.isValid(); ++mfi) {
+    const amrex::Box& bx = mfi.tilebox();
+    auto const& sarr = S.const_array(mfi);
+    auto const& rarr = R.const_array(mfi);
+    auto const& volarr = volume.const_array(mfi);
+    auto const& vfarr = use_vfrac ? vfrac.const_array(mfi)
+                                  : amrex::Array4<const amrex::Real>{};
+    auto const& maskarr = use_mask ? mask->const_array(mfi)
+                                   : amrex::Array4<const amrex::Real>{};
+    reduce_op.eval(
+      bx, reduce_data,
+      [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept -> ReduceTuple {
+        amrex::Real w = volarr(i, j, k);
+        if (use_mask) {
+          w *= maskarr(i, j, k);
+        }
+        if (use_vfrac) {
+          w *= vfarr(i, j, k);
+        }
+        const amrex::Real rho = sarr(i, j, k, URHO);
+        const amrex::Real rho_K =
+          0.5 / rho *
+          (sarr(i, j, k, UMX) * sarr(i, j, k, UMX) +
+           sarr(i, j, k, UMY) * sarr(i, j, k, UMY) +
+           sarr(i, j, k, UMZ) * sarr(i, j, k, UMZ));
+        const amrex::Real fuel_prod =
+          fuel_comp >= 0 ? rarr(i, j, k, fuel_comp) : 0.0;
+        return {w * rho,
+                w * sarr(i, j, k, UMX),
+                w * sarr(i, j, k, UMY),
+                w * sarr(i, j, k, UMZ),
+                w * sarr(i, j, k, UEINT),
+                w * rho_K,
+                w * sarr(i, j, k, UEDEN),
+                w * fuel_prod,
+                w * sarr(i, j, k, UTEMP)};
+      });
+  }
+
+  ReduceTuple hv = reduce_data.value(reduce_op);
+  amrex::GpuArray<amrex::Real, num_iq> sums = {
+    amrex::get<iq_mass>(hv),  amrex::get<iq_xmom>(hv),
+    amrex::get<iq_ymom>(hv),  amrex::get<iq_zmom>(hv),
+    amrex::get<iq_rho_e>(hv), amrex::get<iq_rho_K>(hv),
+    amrex::get<iq_rho_E>(hv), amrex::get<iq_fuel_prod>(hv),
+    amrex::get<iq_temp>(hv)};
+
+  if (!local) {
+    amrex::ParallelDescriptor::ReduceRealSum(sums.data(), num_iq);
+  }
+
+  return sums;
+}
+
 amrex::Real
 PeleC::maxDerive(const std::string& name, amrex::Real time, bool local)
 {
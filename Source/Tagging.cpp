@@ -2,6 +2,7 @@
 
 #include "PeleC.H"
 #include "Tagging.H"
+#include "Utilities.H"
 
 void
 PeleC::read_tagging_params()
@@ -9,37 +10,44 @@ PeleC::read_tagging_params()
   const std::string tag_prefix = "tagging";
   amrex::ParmParse pp(tag_prefix);
 
-  pp.query("denerr", tagging_parm->denerr);
-  pp.query("max_denerr_lev", tagging_parm->max_denerr_lev);
-  pp.query("dengrad", tagging_parm->dengrad);
-  pp.query("max_dengrad_lev", tagging_parm->max_dengrad_lev);
-  pp.query("denratio", tagging_parm->denratio);
-  pp.query("max_denratio_lev", tagging_parm->max_denratio_lev);
-
-  pp.query("presserr", tagging_parm->presserr);
-  pp.query("max_presserr_lev", tagging_parm->max_presserr_lev);
-  pp.query("pressgrad", tagging_parm->pressgrad);
-  pp.query("max_pressgrad_lev", tagging_parm->max_pressgrad_lev);
-
-  pp.query("velerr", tagging_parm->velerr);
-  pp.query("max_velerr_lev", tagging_parm->max_velerr_lev);
-  pp.query("velgrad", tagging_parm->velgrad);
-  pp.query("max_velgrad_lev", tagging_parm->max_velgrad_lev);
-
-  pp.query("vorterr", tagging_parm->vorterr);
-  pp.query("max_vorterr_lev", tagging_parm->max_vorterr_lev);
-
-  pp.query("temperr", tagging_parm->temperr);
-  pp.query("max_temperr_lev", tagging_parm->max_temperr_lev);
-  pp.query("lotemperr", tagging_parm->lotemperr);
-  pp.query("max_lotemperr_lev", tagging_parm->max_lotemperr_lev);
-  pp.query("tempgrad", tagging_parm->tempgrad);
-  pp.query("max_tempgrad_lev", tagging_parm->max_tempgrad_lev);
-
-  pp.query("ftracerr", tagging_parm->ftracerr);
-  pp.query("max_ftracerr_lev", tagging_parm->max_ftracerr_lev);
-  pp.query("ftracgrad", tagging_parm->ftracgrad);
-  pp.query("max_ftracgrad_lev", tagging_parm->max_ftracgrad_lev);
+  // A criterion is only used if its threshold is given
+  const auto query_criterion =
+    [&pp](const std::string& name, amrex::Real& value, int& max_lev) {
+      const bool given = pp.query(name.c_str(), value) != 0;
+      pp.query(("max_" + name + "_lev").c_str(), max_lev);
+      if (!given) {
+        max_lev = 0;
+      }
+    };
+  query_criterion("denerr", tagging_parm->denerr, tagging_parm->max_denerr_lev);
+  query_criterion(
+    "dengrad", tagging_parm->dengrad, tagging_parm->max_dengrad_lev);
+  query_criterion(
+    "denratio", tagging_parm->denratio, tagging_parm->max_denratio_lev);
+
+  query_criterion(
+    "presserr", tagging_parm->presserr, tagging_parm->max_presserr_lev);
+  query_criterion(
+    "pressgrad", tagging_parm->pressgrad, tagging_parm->max_pressgrad_lev);
+
+  query_criterion("velerr", tagging_parm->velerr, tagging_parm->max_velerr_lev);
+  query_criterion(
+    "velgrad", tagging_parm->velgrad, tagging_parm->max_velgrad_lev);
+
+  query_criterion(
+    "vorterr", tagging_parm->vorterr, tagging_parm->max_vorterr_lev);
+
+  query_criterion(
+    "temperr", tagging_parm->temperr, tagging_parm->max_temperr_lev);
+  query_criterion(
+    "lotemperr", tagging_parm->lotemperr, tagging_parm->max_lotemperr_lev);
+  query_criterion(
+    "tempgrad", tagging_parm->tempgrad, tagging_parm->max_tempgrad_lev);
+
+  query_criterion(
+    "ftracerr", tagging_parm->ftracerr, tagging_parm->max_ftracerr_lev);
+  query_criterion(
+    "ftracgrad", tagging_parm->ftracgrad, tagging_parm->max_ftracgrad_lev);
 
   pp.query("vfracerr", tagging_parm->vfracerr);
   pp.query("max_vfracerr_lev", tagging_parm->max_vfracerr_lev);
@@ -155,3 +163,66 @@ PeleC::read_tagging_params()
     }
   }
 }
+
+TagPlan
+PeleC::tag_plan() const
+{
+  TagPlan plan;
+  const TaggingParm& tp = *tagging_parm;
+
+  plan.do_denerr = level < tp.max_denerr_lev;
+  plan.do_dengrad = level < tp.max_dengrad_lev;
+  plan.do_denratio = level < tp.max_denratio_lev;
+  plan.do_presserr = level < tp.max_presserr_lev;
+  plan.do_pressgrad = level < tp.max_pressgrad_lev;
+  plan.do_velerr = level < tp.max_velerr_lev;
+  plan.do_velgrad = level < tp.max_velgrad_lev;
+  plan.do_vorterr = level < tp.max_vorterr_lev;
+  plan.do_temperr = level < tp.max_temperr_lev;
+  plan.do_lotemperr = level < tp.max_lotemperr_lev;
+  plan.do_tempgrad = level < tp.max_tempgrad_lev;
+  plan.do_vfracerr = eb_in_domain && (level < tp.max_vfracerr_lev);
+  if (!flame_trac_name.empty()) {
+    plan.ftrac_idx = find_position(spec_names, flame_trac_name);
+    if (plan.ftrac_idx < 0) {
+      amrex::Abort("Unknown species identified as flame_trac_name");
+    }
+    plan.do_ftracerr = level < tp.max_ftracerr_lev;
+    plan.do_ftracgrad = level < tp.max_ftracgrad_lev;
+  }
+
+  plan.denerr = tp.denerr;
+  plan.dengrad = tp.dengrad;
+  plan.denratio = tp.denratio;
+  plan.presserr = tp.presserr;
+  plan.pressgrad = tp.pressgrad;
+  plan.velerr = tp.velerr;
+  plan.velgrad = tp.velgrad;
+  plan.vorterr = tp.vorterr * std::pow(2.0, level);
+  plan.temperr = tp.temperr;
+  plan.lotemperr = tp.lotemperr;
+  plan.tempgrad = tp.tempgrad;
+  plan.ftracerr = tp.ftracerr;
+  plan.ftracgrad = tp.ftracgrad;
+
+  // Derive the fields that are needed at neighbouring cells; the others are
+  // evaluated in place
+  if (plan.do_pressgrad) {
+    plan.der_pres = plan.nderive;
+    plan.nderive += 1;
+  }
+  if (plan.do_velgrad) {
+    plan.der_vel = plan.nderive;
+    plan.nderive += 3;
+  }
+  if (plan.do_vorterr) {
+    plan.der_vortvel = plan.nderive;
+    plan.nderive += 3;
+  }
+  if (plan.do_ftracgrad) {
+    plan.der_ftrac = plan.nderive;
+    plan.nderive += 1;
+  }
+
+  return plan;
+}
@@ -1,5 +1,32 @@
+#include <cctype>
+#include <cstdlib>
+#include <fcntl.h>
+#include <unistd.h>
+
 #include "Utilities.H"
 
+namespace {
+// Read nbytes at offset from fd, looping over short reads
+void
+pread_all(
+  const int fd,
+  char* buf,
+  const size_t nbytes,
+  const off_t offset,
+  const std::string& iname)
+{
+  size_t done = 0;
+  while (done < nbytes) {
+    const ssize_t n = ::pread(
+      fd, buf + done, nbytes - done, offset + static_cast<off_t>(done));
+    if (n <= 0) {
+      amrex::Abort("Unable to read input file " + iname);
+    }
+    done += static_cast<size_t>(n);
+  }
+}
+} // namespace
+
 // -----------------------------------------------------------
 // Read a binary file
 // INPUTS/OUTPUTS:
@@ -18,15 +45,90 @@ read_binary(
   const size_t ncol,
   amrex::Vector<double>& data /*needs to be double*/)
 {
-  std::ifstream infile(iname, std::ios::in | std::ios::binary);
-  if (!infile.is_open()) {
+  const int fd = ::open(iname.c_str(), O_RDONLY);
+  if (fd < 0) {
     amrex::Abort("Unable to open input file " + iname);
   }
+  data.resize(nx * ny * nz * ncol);
+  pread_all(
+    fd, reinterpret_cast<char*>(data.data()), data.size() * sizeof(double), 0,
+    iname);
+  ::close(fd);
+}
 
-  for (size_t i = 0; i < nx * ny * nz * ncol; i++) {
-    infile.read(reinterpret_cast<char*>(&data[i]), sizeof(data[i]));
+// -----------------------------------------------------------
+// Read the part of a binary file that falls in a periodic index
+// window, with one bulk read per contiguous x run
+// INPUTS/OUTPUTS:
+// iname => filename
+// nx    => input resolution
+// ny    => input resolution
+// nz    => input resolution
+// ncol  => number of columns per row in the file
+// lo    => lower index of the window (wrapped into the input)
+// len   => window size in each direction (at most the input size)
+// col0  => first column to keep
+// ncolw => number of columns to keep
+// data  <= output data, data[c + ncolw * (i + len[0] * (j + len[1] * k))]
+// -----------------------------------------------------------
+void
+read_binary_window(
+  const std::string& iname,
+  const size_t nx,
+  const size_t ny,
+  const size_t nz,
+  const size_t ncol,
+  const amrex::IntVect& lo,
+  const amrex::IntVect& len,
+  const size_t col0,
+  const size_t ncolw,
+  amrex::Vector<double>& data /*needs to be double*/)
+{
+  AMREX_ALWAYS_ASSERT(col0 + ncolw <= ncol);
+  AMREX_ALWAYS_ASSERT(
+    len[0] <= static_cast<int>(nx) && len[1] <= static_cast<int>(ny) &&
+    len[2] <= static_cast<int>(nz));
+
+  const int fd = ::open(iname.c_str(), O_RDONLY);
+  if (fd < 0) {
+    amrex::Abort("Unable to open input file " + iname);
   }
-  infile.close();
+
+  const size_t wx = len[0];
+  const size_t wy = len[1];
+  const size_t wz = len[2];
+  data.resize(wx * wy * wz * ncolw);
+  amrex::Vector<double> row(wx * ncol);
+  const auto wrap = [](const int i, const size_t n) {
+    return static_cast<size_t>(((i % static_cast<int>(n)) + n) % n);
+  };
+  const size_t i0 = wrap(lo[0], nx);
+  // the x run wraps around the end of the input at most once
+  const size_t nfirst = std::min(wx, nx - i0);
+
+  for (size_t kk = 0; kk < wz; kk++) {
+    const size_t k = wrap(lo[2] + static_cast<int>(kk), nz);
+    for (size_t jj = 0; jj < wy; jj++) {
+      const size_t j = wrap(lo[1] + static_cast<int>(jj), ny);
+      const size_t rowstart = nx * (j + ny * k);
+      pread_all(
+        fd, reinterpret_cast<char*>(row.data()), nfirst * ncol * sizeof(double),
+        static_cast<off_t>((rowstart + i0) * ncol * sizeof(double)), iname);
+      if (nfirst < wx) {
+        pread_all(
+          fd, reinterpret_cast<char*>(row.data() + nfirst * ncol),
+          (wx - nfirst) * ncol * sizeof(double),
+          static_cast<off_t>(rowstart * ncol * sizeof(double)), iname);
+      }
+      double* out = data.data() + ncolw * wx * (jj + wy * kk);
+      for (size_t ii = 0; ii < wx; ii++) {
+        for (size_t c = 0; c < ncolw; c++) {
+          out[c + ncolw * ii] = row[col0 + c + ncol * ii];
+        }
+      }
+    }
+  }
+  ::close(fd);
 }
 
 // -----------------------------------------------------------
@@ -47,20 +149,46 @@ read_csv(
   amrex::Vector<amrex::Real>& data)
 {
   std::ifstream infile(iname, std::ios::in);
-  const std::string memfile = read_file(infile);
   if (!infile.is_open()) {
     amrex::Abort("Unable to open input file " + iname);
   }
+  const std::string memfile = read_file(infile);
   infile.close();
-  std::istringstream iss(memfile);
 
-  // Read the file
+  // Parse the file in a single pass, skipping the header line
+  size_t pos = memfile.find('\n');
+  pos = (pos == std::string::npos) ? memfile.size() : pos + 1;
   size_t nlines = 0;
-  std::string firstline;
-  std::string line;
-  std::getline(iss, firstline); // skip header
-  while (getline(iss, line)) {
-    ++nlines;
+  size_t cnt = 0;
+  const auto is_sep = [](const char c) {
+    return (c == ',') || (std::isspace(static_cast<unsigned char>(c)) != 0);
+  };
+  while (pos < memfile.size()) {
+    size_t eol = memfile.find('\n', pos);
+    if (eol == std::string::npos) {
+      eol = memfile.size();
+    }
+    if (eol > pos) {
+      ++nlines;
+      const char* p = memfile.data() + pos;
+      const char* const eolp = memfile.data() + eol;
+      while (p < eolp) {
+        char* next = nullptr;
+        const double val = std::strtod(p, &next);
+        if ((next == p) || (next > eolp)) {
+          break;
+        }
+        if (cnt < data.size()) {
+          data[cnt] = val;
+        }
+        cnt++;
+        p = next;
+        while ((p < eolp) && is_sep(*p)) {
+          ++p;
+        }
+      }
+    }
+    pos = eol + 1;
   }
 
   // Quick sanity check
@@ -69,20 +197,76 @@ read_csv(
       "Number of lines in the input file (= " + std::to_string(nlines) +
       ") does not match the input resolution (=" + std::to_string(nx) + ")");
   }
+}
 
-  // Read the data from the file
-  iss.clear();
-  iss.seekg(0, std::ios::beg);
-  std::getline(iss, firstline); // skip header
-  int cnt = 0;
-  while (std::getline(iss, line)) {
-    std::istringstream linestream(line);
-    std::string value;
-    while (getline(linestream, value, ',')) {
-      std::istringstream sinput(value);
-      sinput >> data[cnt];
-      cnt++;
+// -----------------------------------------------------------
+// Find the smallest periodic index window of a periodic input cube
+// that holds the points used by the linear interpolation onto the
+// cell centers of the grids this rank owns
+// INPUTS/OUTPUTS:
+// grids  => grids of the level
+// dmap   => distribution map of the level
+// geom   => geometry of the level
+// xarray => input point coordinates (same in every direction)
+// inres  => input resolution
+// Linput => period of the input cube
+// lo     <= lower index of the window
+// len    <= window size in each direction (1 without owned grids)
+// -----------------------------------------------------------
+void
+input_window(
+  const amrex::BoxArray& grids,
+  const amrex::DistributionMapping& dmap,
+  const amrex::Geometry& geom,
+  const amrex::Real* xarray,
+  const int inres,
+  const amrex::Real Linput,
+  amrex::IntVect& lo,
+  amrex::IntVect& len)
+{
+  const amrex::Real* prob_lo = geom.ProbLo();
+  const amrex::Real* dx = geom.CellSize();
+  const int myproc = amrex::ParallelDescriptor::MyProc();
+
+  // Mark the used input points. The smallest periodic window holding them
+  // starts right after the longest run of unused points.
+  lo = amrex::IntVect(0);
+  len = amrex::IntVect(1);
+  for (int dir = 0; dir < AMREX_SPACEDIM; dir++) {
+    amrex::Vector<char> used(inres, 0);
+    bool owns_grids = false;
+    for (int ib = 0; ib < grids.size(); ib++) {
+      if (dmap[ib] != myproc) {
+        continue;
+      }
+      owns_grids = true;
+      const amrex::Box& bx = grids[ib];
+      for (int ii = bx.smallEnd(dir); ii <= bx.bigEnd(dir); ii++) {
+        const amrex::Real x =
+          prob_lo[dir] + static_cast<amrex::Real>(ii + 0.5) * dx[dir];
+        int idx = 0;
+        locate(xarray, inres, std::fmod(x, Linput), idx);
+        used[idx] = 1;
+        used[(idx + 1) % inres] = 1;
+      }
     }
+    if (!owns_grids) {
+      break;
+    }
+
+    int gap = 0;
+    int max_gap = 0;
+    int gap_end = 0;
+    for (int n = 0; n < 2 * inres; n++) {
+      if (used[n % inres] != 0) {
+        gap = 0;
+      } else if (++gap > max_gap) {
+        max_gap = gap;
+        gap_end = n + 1;
+      }
+    }
+    lo[dir] = gap_end % inres;
+    len[dir] = inres - max_gap;
   }
 }
 
@@ -116,22 +300,16 @@ clean_massfrac(
         const amrex::Real rhoOld_inv = 1.0 / rhoOld;
 
         // Check for OOB mass fraction
-        bool clean = false;
-        for (int n = 0; n < NUM_SPECIES; n++) {
-          const auto mf = rhoY(iv, n) * rhoOld_inv;
-          if ((mf < -threshold) || ((1.0 + threshold) < mf)) {
-            clean = true;
-          }
-        }
+        SpeciesBlock spec;
+        spec.gather(rhoY, iv, 0);
+        SpeciesBlock mf = spec;
+        mf.scale(rhoOld_inv);
 
-        if (clean) {
+        if (mf.any_outside(-threshold, 1.0 + threshold)) {
           // Clip species rhoYs and get new rho
-          amrex::Real rhoNew = 0.0;
-          for (int n = 0; n < NUM_SPECIES; n++) {
-            rhoY(iv, n) = amrex::min<amrex::Real>(
-              rhoOld, amrex::max<amrex::Real>(0.0, rhoY(iv, n)));
-            rhoNew += rhoY(iv, n);
-          }
+          spec.clamp(0.0, rhoOld);
+          spec.scatter(rhoY, iv, 0);
+          const amrex::Real rhoNew = spec.sum();
           rho(iv) = rhoNew;
 
           // Keep kinetic energy, recompute, rhoe, rhoE, and rhoU
@@ -34,6 +34,16 @@ override_default_parameters()
     std::string geom_type("all_regular");
     pp.add("geom_type", geom_type);
   }
+
+  // pelec.async_output writes plotfiles and checkpoints from a background
+  // I/O thread on each rank; this has to be set before AMReX reads amrex.*
+  amrex::ParmParse pp_pelec("pelec");
+  bool async_output = false;
+  pp_pelec.query("async_output", async_output);
+  amrex::ParmParse pp_amrex("amrex");
+  if (async_output && !pp_amrex.contains("async_out")) {
+    pp_amrex.add("async_out", 1);
+  }
 }
 
 int
@@ -176,6 +186,9 @@ main(int argc, char* argv[])
     amrptr->writePlotFile();
   }
 
+  // Drain any output still queued on the I/O thread
+  amrptr->finishAsyncOutput();
+
   time(&time_type);
   gmtime_r(&time_type, &time_now);
 